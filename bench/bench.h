@@ -0,0 +1,37 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "util/includes.h"
+#include <chrono>
+#include <iostream>
+#include <random>
+
+/**
+ * @brief Wall time of one call of fn in milliseconds
+ */
+template <typename Fn>
+double timeMs(Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// fixed seed so every run measures the same queries
+inline std::mt19937& benchRng() {
+    static std::mt19937 rng(1234);
+    return rng;
+}
+
+inline vec2 randomPoint(const vec2& lo, const vec2& hi) {
+    std::uniform_real_distribution<float> x(lo.x, hi.x);
+    std::uniform_real_distribution<float> y(lo.y, hi.y);
+    return { x(benchRng()), y(benchRng()) };
+}
+
+// benches, one per file
+void navmeshLocateBench();
+void astarBench();
+void containsBench();
+void broadphaseBench();
+
+#endif
@@ -0,0 +1,102 @@
+#include "bench.h"
+#include "character/character.h"
+#include "util/spatialHash.h"
+
+static const vec2 ARENA_SIZE = { 40.0f, 30.0f };
+
+/**
+ * @brief Stress scene for the side collision pass: hundreds to thousands of projectiles bouncing around a paper sized
+ * arena with a crowd of enemies. Each frame does what SingleSide::update does with its zones, first player zones
+ * against enemy zones and then every zone against the characters, once through the spatial hashes and once with the
+ * nested loops they replaced. Both must report the same number of overlapping pairs
+ */
+void broadphaseBench() {
+    const uint FRAMES = 120;
+    const uint ENEMIES = 200;
+    const float PROJECTILE_RADIUS = 0.15f;
+    const float ENEMY_RADIUS = 0.4f;
+    const float DT = 1.0f / 60.0f;
+
+    std::vector<vec2> enemyPositions(ENEMIES);
+    for (vec2& p : enemyPositions) {
+        p = randomPoint(vec2(0.0f), ARENA_SIZE);
+    }
+
+    for (uint count : { 100u, 400u, 1600u, 6400u }) {
+        // half the projectiles are the player's, half come from enemies
+        std::vector<vec2> positions(count);
+        std::vector<vec2> velocities(count);
+        std::vector<uint> layers(count);
+        for (uint i = 0; i < count; i++) {
+            positions[i] = randomPoint(vec2(0.0f), ARENA_SIZE);
+            velocities[i] = randomPoint(vec2(-8.0f), vec2(8.0f));
+            layers[i] = i % 2 ? TEAM_ENEMY : TEAM_ALLY;
+        }
+
+        auto step = [&]() {
+            for (uint i = 0; i < count; i++) {
+                positions[i] += velocities[i] * DT;
+                for (int axis = 0; axis < 2; axis++) {
+                    if (positions[i][axis] < 0.0f || positions[i][axis] > ARENA_SIZE[axis]) velocities[i][axis] *= -1.0f;
+                }
+            }
+        };
+
+        SpatialHash zoneHash;
+        SpatialHash enemyHash;
+        uint64_t hashedPairs = 0;
+        std::vector<vec2> startPositions = positions;
+        std::vector<vec2> startVelocities = velocities;
+        double hashedMs = timeMs([&]() {
+            for (uint frame = 0; frame < FRAMES; frame++) {
+                step();
+
+                zoneHash.clear();
+                for (uint i = 0; i < count; i++) {
+                    zoneHash.insert(positions[i], PROJECTILE_RADIUS, layers[i], i);
+                }
+                zoneHash.build();
+                for (uint i = 0; i < count; i++) {
+                    if (!(layers[i] & TEAM_ALLY)) continue;
+                    zoneHash.query(positions[i], PROJECTILE_RADIUS, TEAM_ENEMY, [&](uint) { hashedPairs++; });
+                }
+
+                enemyHash.clear();
+                for (uint j = 0; j < ENEMIES; j++) {
+                    enemyHash.insert(enemyPositions[j], ENEMY_RADIUS, TEAM_ENEMY, j);
+                }
+                enemyHash.build();
+                for (uint i = 0; i < count; i++) {
+                    if (!(layers[i] & TEAM_ALLY)) continue;
+                    enemyHash.query(positions[i], PROJECTILE_RADIUS, TEAM_ENEMY, [&](uint) { hashedPairs++; });
+                }
+            }
+        });
+
+        // replay the same frames from the same start with the old nested loops
+        positions = startPositions;
+        velocities = startVelocities;
+        uint64_t brutePairs = 0;
+        const float zoneReach = 4.0f * PROJECTILE_RADIUS * PROJECTILE_RADIUS;
+        const float enemyReach = (PROJECTILE_RADIUS + ENEMY_RADIUS) * (PROJECTILE_RADIUS + ENEMY_RADIUS);
+        double bruteMs = timeMs([&]() {
+            for (uint frame = 0; frame < FRAMES; frame++) {
+                step();
+
+                for (uint i = 0; i < count; i++) {
+                    if (!(layers[i] & TEAM_ALLY)) continue;
+                    for (uint j = 0; j < count; j++) {
+                        if (!(layers[j] & TEAM_ENEMY)) continue;
+                        brutePairs += glm::length2(positions[i] - positions[j]) <= zoneReach;
+                    }
+                    for (uint j = 0; j < ENEMIES; j++) {
+                        brutePairs += glm::length2(positions[i] - enemyPositions[j]) <= enemyReach;
+                    }
+                }
+            }
+        });
+
+        std::cout << count << " projectiles, " << ENEMIES << " enemies: hashed " << hashedMs / FRAMES << " ms/frame, nested loops "
+                  << bruteMs / FRAMES << " ms/frame, " << hashedPairs << "/" << brutePairs << " pairs" << std::endl;
+    }
+}
@@ -0,0 +1,60 @@
+#include "bench.h"
+#include "levels/uvregion.h"
+
+/**
+ * @brief Star shaped (concave) polygon with the given vertex count around the origin
+ */
+static std::vector<vec2> makeStar(uint vertices, float radius) {
+    std::vector<vec2> star(vertices);
+    for (uint i = 0; i < vertices; i++) {
+        float angle = 2.0f * glm::pi<float>() * i / vertices;
+        float r = (i % 2 == 0) ? radius : 0.5f * radius;
+        star[i] = r * vec2(std::cos(angle), std::sin(angle));
+    }
+    return star;
+}
+
+/**
+ * @brief UVRegion::containsMany against calling contains per point, on concave polygons of growing size.
+ * Also counts points where the two disagree, which should always be 0
+ */
+void containsBench() {
+    const uint POINTS = 4096;
+    const uint REPEATS = 50;
+    const float RADIUS = 10.0f;
+
+    for (uint vertices : { 8u, 32u, 128u, 512u }) {
+        std::array<Vert, 2> basis = { Vert({ 1.0f, 0.0f }, { 1.0f, 0.0f }), Vert({ 0.0f, 1.0f }, { 0.0f, 1.0f }) };
+        UVRegion region(makeStar(vertices, RADIUS), basis, vec2(0.0f));
+
+        std::vector<vec2> points(POINTS);
+        for (vec2& p : points) {
+            p = randomPoint(vec2(-RADIUS), vec2(RADIUS));
+        }
+
+        std::vector<uint8_t> single(POINTS);
+        std::vector<uint8_t> batched(POINTS);
+        double singleMs = timeMs([&]() {
+            for (uint r = 0; r < REPEATS; r++) {
+                for (uint i = 0; i < POINTS; i++) {
+                    single[i] = region.contains(points[i]);
+                }
+            }
+        });
+        double batchedMs = timeMs([&]() {
+            for (uint r = 0; r < REPEATS; r++) {
+                region.containsMany(points, batched);
+            }
+        });
+
+        uint mismatches = 0;
+        for (uint i = 0; i < POINTS; i++) {
+            mismatches += single[i] != batched[i];
+        }
+
+        double tests = (double)POINTS * REPEATS;
+        std::cout << vertices << " vertices: contains " << singleMs * 1e6 / tests << " ns/point, containsMany "
+                  << batchedMs * 1e6 / tests << " ns/point (" << singleMs / batchedMs << "x), "
+                  << mismatches << " mismatches" << std::endl;
+    }
+}
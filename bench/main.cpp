@@ -0,0 +1,26 @@
+#include "bench.h"
+#include <string>
+
+/**
+ * @brief Headless benchmarks, no window or engine. Runs every bench, or only the ones named on the command line
+ */
+int main(int argc, char** argv) {
+    const std::vector<std::pair<std::string, void(*)()>> benches = {
+        { "locate", navmeshLocateBench },
+        { "astar", astarBench },
+        { "contains", containsBench },
+        { "broadphase", broadphaseBench },
+    };
+
+    for (const auto& [name, run] : benches) {
+        bool selected = argc < 2;
+        for (int i = 1; i < argc; i++) {
+            selected = selected || name == argv[i];
+        }
+        if (!selected) continue;
+
+        std::cout << "== " << name << std::endl;
+        run();
+    }
+    return 0;
+}
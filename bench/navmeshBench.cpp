@@ -0,0 +1,101 @@
+#include "bench.h"
+#include "levels/navmesh.h"
+#include <string>
+
+static const vec2 PAPER_SIZE = { 40.0f, 30.0f };
+
+/**
+ * @brief Paper sized rectangle with a side x side grid of square obstacles, roughly what a few folds leave behind
+ */
+static Navmesh makeObstacleField(uint side) {
+    Navmesh navmesh({ { 0.0f, 0.0f }, { PAPER_SIZE.x, 0.0f }, PAPER_SIZE, { 0.0f, PAPER_SIZE.y } });
+
+    vec2 cell = PAPER_SIZE / (float)(side + 1);
+    float half = 0.2f * std::min(cell.x, cell.y);
+    for (uint y = 1; y <= side; y++) {
+        for (uint x = 1; x <= side; x++) {
+            vec2 c = cell * vec2(x, y);
+            navmesh.addObstacle({ c + vec2(-half, -half), c + vec2(half, -half), c + vec2(half, half), c + vec2(-half, half) });
+        }
+    }
+
+    navmesh.generateNavmesh();
+    return navmesh;
+}
+
+/**
+ * @brief Point location cost as the triangulation grows. With the triangle grid the time per lookup should stay
+ * about flat, a scan over every triangle grows with the triangle count
+ */
+void navmeshLocateBench() {
+    const uint LOOKUPS = 200000;
+
+    for (uint side : { 2u, 4u, 8u, 16u, 32u }) {
+        Navmesh navmesh = makeObstacleField(side);
+
+        std::vector<vec2> points(LOOKUPS);
+        for (vec2& p : points) {
+            p = randomPoint(vec2(0.0f), PAPER_SIZE);
+        }
+
+        uint found = 0;
+        double ms = timeMs([&]() {
+            for (const vec2& p : points) {
+                found += navmesh.locate(p) >= 0;
+            }
+        });
+
+        std::cout << side * side << " obstacles, " << navmesh.getTriangleCount() << " triangles: "
+                  << ms * 1e6 / LOOKUPS << " ns/lookup, " << found << "/" << LOOKUPS << " on the mesh" << std::endl;
+    }
+}
+
+/**
+ * @brief A* throughput in queries per second between random points, on a 160 vertex ring (the shape the flat
+ * search rewrite was first timed on) and on obstacle fields. Repeated triangle pairs hit the corridor cache, 
+ * the hit count is printed so the two can be told apart
+ */
+void astarBench() {
+    const uint QUERIES = 20000;
+
+    auto run = [&](const std::string& label, Navmesh& navmesh, const vec2& lo, const vec2& hi) {
+        std::vector<std::pair<vec2, vec2>> queries(QUERIES);
+        for (auto& [start, dest] : queries) {
+            start = randomPoint(lo, hi);
+            dest = randomPoint(lo, hi);
+        }
+
+        std::vector<vec2> path;
+        uint64_t expansions = 0;
+        uint64_t found = 0;
+        double ms = timeMs([&]() {
+            for (const auto& [start, dest] : queries) {
+                navmesh.getPath(path, start, dest, 0.3f);
+                expansions += navmesh.getLastExpansions();
+                found += !path.empty();
+            }
+        });
+
+        std::cout << label << ", " << navmesh.getTriangleCount() << " triangles: " << QUERIES / (ms * 1e-3) << " queries/s, "
+                  << (double)expansions / QUERIES << " expansions/query, " << found << " paths, "
+                  << navmesh.getCacheHits() << " cache hits" << std::endl;
+    };
+
+    // ring, sampled inside its inscribed square so every query starts on the mesh
+    const uint RING_VERTICES = 160;
+    const float RADIUS = 15.0f;
+    std::vector<vec2> ring(RING_VERTICES);
+    for (uint i = 0; i < RING_VERTICES; i++) {
+        float angle = 2.0f * glm::pi<float>() * i / RING_VERTICES;
+        ring[i] = RADIUS * vec2(std::cos(angle), std::sin(angle));
+    }
+    Navmesh ringMesh(ring);
+    ringMesh.generateNavmesh();
+    float inner = RADIUS * 0.7f;
+    run("160 vertex ring", ringMesh, vec2(-inner), vec2(inner));
+
+    for (uint side : { 4u, 16u }) {
+        Navmesh navmesh = makeObstacleField(side);
+        run(std::to_string(side * side) + " obstacles", navmesh, vec2(0.0f), PAPER_SIZE);
+    }
+}
@@ -126,6 +126,14 @@ void SFXPlayer::Play(const std::string& name) {
 }
 
 void SFXPlayer::PlayWithVolume(const std::string& name, float volume) {
+    {
+        std::lock_guard<std::mutex> lock(deferred_mutex_);
+        if (deferring_) {
+            deferred_.emplace_back(name, volume);
+            return;
+        }
+    }
+
     if (!initialized_) {
         std::cerr << "SFXPlayer: Not initialized! Call Initialize() first." << std::endl;
         return;
@@ -139,6 +147,24 @@ void SFXPlayer::PlayWithVolume(const std::string& name, float volume) {
     }
 }
 
+void SFXPlayer::BeginDeferred() {
+    std::lock_guard<std::mutex> lock(deferred_mutex_);
+    deferring_ = true;
+}
+
+void SFXPlayer::EndDeferred() {
+    std::vector<std::pair<std::string, float>> queued;
+    {
+        std::lock_guard<std::mutex> lock(deferred_mutex_);
+        deferring_ = false;
+        queued.swap(deferred_);
+    }
+
+    for (const auto& [name, volume] : queued) {
+        PlayWithVolume(name, volume);
+    }
+}
+
 SFXPlayer& SFXPlayer::Get() {
     static SFXPlayer instance; // Meyers singleton - thread-safe in C++11+
     return instance;
@@ -6,6 +6,8 @@
 #include <memory>
 #include <unordered_map>
 #include <string>
+#include <vector>
+#include <mutex>
 
 namespace audio {
 
@@ -21,6 +23,11 @@ private:
     std::unordered_map<std::string, std::unique_ptr<RandomSoundContainer>> containers_;
     bool initialized_;
 
+    // command buffer for sounds requested while deferred, possibly from several threads
+    std::mutex deferred_mutex_;
+    std::vector<std::pair<std::string, float>> deferred_;
+    bool deferring_ = false;
+
     // Private constructor for singleton
     SFXPlayer();
     
@@ -56,6 +63,17 @@ public:
      * @param volume Volume level (0.0 to 1.0)
      */
     void PlayWithVolume(const std::string& sfx_name, float volume);
+
+    /**
+     * @brief Queue every sound requested until EndDeferred instead of playing it. Play and PlayWithVolume
+     * are safe to call from any thread while deferred. Call both from the main thread
+     */
+    void BeginDeferred();
+
+    /**
+     * @brief Stop deferring and play the queued sounds in the order they were requested
+     */
+    void EndDeferred();
 };
 
 } // namespace audio
@@ -4,6 +4,7 @@
 #include "util/includes.h"
 
 class Enemy;
+struct SideSnapshot;
 
 // Base class for enemy behaviors
 class Behavior {
@@ -12,7 +13,7 @@ public:
     
     // Update the enemy's behavior - called each frame
     // Returns true if behavior should continue, false if it should switch
-    virtual void update(Enemy* enemy, const vec2& playerPos, float dt) = 0;
+    virtual void update(Enemy* enemy, const SideSnapshot& snapshot, float dt) = 0;
     
     // Get a display name for this behavior (for debugging)
     virtual std::string getName() const = 0;
@@ -2,6 +2,7 @@
 #include "character/enemy.h"
 #include "character/character.h"
 #include "levels/paperMesh.h"
+#include "levels/sideSnapshot.h"
 
 // Helper function to check if destination is reached
 static bool isDestinationReached(Enemy* enemy, const std::vector<vec2>& path) {
@@ -118,15 +119,26 @@ static void updateDestinationWandering(
     updatePathFollowing(enemy, fallbackDir);
 }
 
-void ChasePlayerBehavior::update(Enemy* enemy, const vec2& playerPos, float dt) {
+void ChasePlayerBehavior::update(Enemy* enemy, const SideSnapshot& snapshot, float dt) {
+    const vec2& playerPos = snapshot.playerPos;
+
     // Get the paper mesh for pathfinding
-    PaperMesh* paperMesh = enemy->getPaperMeshForSide();
+    PaperMesh* paperMesh = snapshot.paperMesh;
     if (!paperMesh) return;
     
-    // Update path to player
+    // Update path to player, reading the shared flow field when the side has one
     std::vector<vec2>& path = enemy->getPath();
     float padding = enemy->getRadius() * 1.2f;
-    paperMesh->getPath(path, enemy->getPosition(), playerPos, padding);
+    vec2 waypoint;
+    if (paperMesh->getFlowWaypoint(enemy->getPosition(), playerPos, waypoint, padding)) {
+        path.clear();
+        path.push_back(waypoint);
+        if (glm::length2(waypoint - playerPos) > 1e-6f) {
+            path.push_back(playerPos);
+        }
+    } else {
+        paperMesh->getPath(path, enemy->getPosition(), playerPos, padding);
+    }
     
     // Handle path following logic
     if (path.size() == 0) {
@@ -157,13 +169,15 @@ void ChasePlayerBehavior::update(Enemy* enemy, const vec2& playerPos, float dt)
     }
 }
 
-void RunawayBehavior::update(Enemy* enemy, const vec2& playerPos, float dt) {
+void RunawayBehavior::update(Enemy* enemy, const SideSnapshot& snapshot, float dt) {
+    const vec2& playerPos = snapshot.playerPos;
+
     vec2 enemyPos = enemy->getPosition();
     vec2 toPlayer = playerPos - enemyPos;
-    float distance = glm::length(toPlayer);
+    float distance = enemy->playerDistanceStatus();
     
     // Get the paper mesh for pathfinding
-    PaperMesh* paperMesh = enemy->getPaperMeshForSide();
+    PaperMesh* paperMesh = snapshot.paperMesh;
     
     // Calculate fallback direction (directly away from player)
     vec2 fallbackDir = vec2(0, 0);
@@ -237,13 +251,15 @@ void RunawayBehavior::update(Enemy* enemy, const vec2& playerPos, float dt) {
     updateDestinationWandering(enemy, paperMesh, playerPos, destinationSelector, fallbackDir);
 }
 
-void IdleBehavior::update(Enemy* enemy, const vec2& playerPos, float dt) {
+void IdleBehavior::update(Enemy* enemy, const SideSnapshot& snapshot, float dt) {
     enemy->getMoveDir() = vec2(0, 0);
     enemy->getPath().clear();
     enemy->clearCustomDestination();
 }
 
-void StationaryBehavior::update(Enemy* enemy, const vec2& playerPos, float dt) {
+void StationaryBehavior::update(Enemy* enemy, const SideSnapshot& snapshot, float dt) {
+    const vec2& playerPos = snapshot.playerPos;
+
     enemy->getMoveDir() = vec2(0, 0);
     enemy->getPath().clear();
     enemy->clearCustomDestination();
@@ -254,9 +270,11 @@ void StationaryBehavior::update(Enemy* enemy, const vec2& playerPos, float dt) {
     }
 }
 
-void WanderBehavior::update(Enemy* enemy, const vec2& playerPos, float dt) {
+void WanderBehavior::update(Enemy* enemy, const SideSnapshot& snapshot, float dt) {
+    const vec2& playerPos = snapshot.playerPos;
+
     // Get the paper mesh for pathfinding
-    PaperMesh* paperMesh = enemy->getPaperMeshForSide();
+    PaperMesh* paperMesh = snapshot.paperMesh;
     
     // Update wander destination timer
     float& wanderTimer = enemy->getWanderDestinationTimer();
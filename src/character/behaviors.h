@@ -6,14 +6,14 @@
 // Chase player behavior - follows the player using pathfinding
 class ChasePlayerBehavior : public Behavior {
 public:
-    void update(Enemy* enemy, const vec2& playerPos, float dt) override;
+    void update(Enemy* enemy, const SideSnapshot& snapshot, float dt) override;
     std::string getName() const override { return "ChasePlayer"; }
 };
 
 // Runaway behavior - runs away from the player
 class RunawayBehavior : public Behavior {
 public:
-    void update(Enemy* enemy, const vec2& playerPos, float dt) override;
+    void update(Enemy* enemy, const SideSnapshot& snapshot, float dt) override;
     std::string getName() const override { return "Runaway"; }
     
 private:
@@ -24,14 +24,14 @@ private:
 // Idle behavior - stands still and does nothing
 class IdleBehavior : public Behavior {
 public:
-    void update(Enemy* enemy, const vec2& playerPos, float dt) override;
+    void update(Enemy* enemy, const SideSnapshot& snapshot, float dt) override;
     std::string getName() const override { return "Idle"; }
 };
 
 // Stationary behavior - stands still but attacks if player is in range
 class StationaryBehavior : public Behavior {
 public:
-    void update(Enemy* enemy, const vec2& playerPos, float dt) override;
+    void update(Enemy* enemy, const SideSnapshot& snapshot, float dt) override;
     std::string getName() const override { return "Stationary"; }
     
 private:
@@ -41,7 +41,7 @@ private:
 // Wander behavior - moves to random non-obstacle positions
 class WanderBehavior : public Behavior {
 public:
-    void update(Enemy* enemy, const vec2& playerPos, float dt) override;
+    void update(Enemy* enemy, const SideSnapshot& snapshot, float dt) override;
     std::string getName() const override { return "Wander"; }
 };
 
@@ -3,6 +3,7 @@
 #include "weapon/weapon.h"
 #include "game/game.h"
 #include "audio/sfx_player.h"
+#include <mutex>
 
 
 Character::Character(Game* game, int health, float speed, Node2D* node, SingleSide* side, Weapon* weapon, std::string team, float radius, vec2 scale, std::string damageSound) : 
@@ -14,6 +15,7 @@ Character::Character(Game* game, int health, float speed, Node2D* node, SingleSi
     side(side), 
     weapon(weapon), 
     team(team),
+    teamLayer(teamLayerOf(team)),
     radius(radius),
     scale(scale),
     damageSound(damageSound)
@@ -21,6 +23,22 @@ Character::Character(Game* game, int health, float speed, Node2D* node, SingleSi
     node->setManifoldMask(1, 1, 0);
 }
 
+/**
+ * @brief Gets the collision layer bit for a team name. Ally and Enemy have fixed bits, any other team is given the next free bit the first time it is seen
+ */
+uint Character::teamLayerOf(const std::string& team) {
+    static std::unordered_map<std::string, uint> layers = { { "Ally", TEAM_ALLY }, { "Enemy", TEAM_ENEMY } };
+    static std::mutex mutex; // characters can be made while both paper sides simulate
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = layers.find(team);
+    if (it != layers.end()) return it->second;
+
+    uint bit = layers.size();
+    if (bit >= 32) throw std::runtime_error("Character::teamLayerOf: too many teams for the collision layer mask");
+    return layers[team] = 1u << bit;
+}
+
 Character::~Character() {
     delete weapon; weapon = nullptr;
     delete node; node = nullptr;
@@ -8,7 +8,16 @@ class Weapon;
 class Game;
 struct PaperMesh;
 
+// collision layer bits, one per team, so team checks in the broadphase are a mask test instead of a string compare
+enum TeamLayer : uint {
+    TEAM_ALLY = 1u << 0,
+    TEAM_ENEMY = 1u << 1,
+};
+
 class Character {
+public:
+    static uint teamLayerOf(const std::string& team);
+
 protected:
     int maxHealth;
     int health;
@@ -20,6 +29,7 @@ protected:
     Weapon* weapon;
     Node2D* node;
     std::string team;
+    uint teamLayer;
     vec2 scale;
     std::string damageSound;
     bool unstable = false;
@@ -42,7 +52,8 @@ public:
     int& getHealth() { return health; }
     float& getSpeed() { return speed; }
     Weapon*& getWeapon() { return weapon; }
-    std::string getTeam() { return team; }
+    const std::string& getTeam() const { return team; }
+    uint getTeamLayer() const { return teamLayer; }
     Node2D* getNode() { return node; }
     SingleSide* getSide() { return side; }
     Game* getGame() { return game; }
@@ -59,7 +70,7 @@ public:
     void setHealth(int health) { this->health = health; }
     void setSpeed(float speed) { this->speed = speed; }
     void setWeapon(Weapon* weapon) { this->weapon = weapon; }
-    void setTeam(std::string team) { this->team = team; }
+    void setTeam(std::string team) { this->team = team; this->teamLayer = teamLayerOf(this->team); }
 
     void setVelocity(const vec3& velocity) { this->node->setVelocity(velocity); }
     void setPosition(const vec2& position) { this->node->setPosition(position); }
@@ -6,6 +6,7 @@
 #include "weapon/weapon.h"
 #include "audio/sfx_player.h"
 #include "pickup/heart.h"
+#include "levels/pathWorkers.h"
 
 Enemy::Enemy(Game* game, int health, float speed, Node2D* node, SingleSide* side, Weapon* weapon, AI* ai, float radius, vec2 scale, std::string hitSound, float attackDelay) 
     : Character(game, health, speed, node, side, weapon, "Enemy", radius, scale, hitSound), ai(ai), path(), attackDelay(attackDelay), attackDelayTimer(2.0f), attackPending(false)
@@ -26,6 +27,7 @@ Enemy::Enemy(Game* game, int health, float speed, Node2D* node, SingleSide* side
 
 Enemy::~Enemy() {
     delete animator; animator = nullptr;
+    PathWorkers::get().cancel(pathRequest);
 }
 
 void Enemy::onDamage(int damage) {
@@ -34,36 +36,31 @@ void Enemy::onDamage(int damage) {
 
 void Enemy::onDeath() {
     if (uniform(0.0f, 1.0f) < 0.2f) {
-        side->addPickup(new Heart(game, side, { .mesh=game->getMesh("quad"), .material=game->getMaterial("red"), .position=getPosition(), .scale={1.0, 1.0} }, 0.5f));
+        side->deferToSync([game = game, side = side, pos = getPosition()]() {
+            side->addPickup(new Heart(game, side, { .mesh=game->getMesh("quad"), .material=game->getMaterial("red"), .position=pos, .scale={1.0, 1.0} }, 0.5f));
+        });
     }
 
     Character::onDeath();
 }
 
-void Enemy::updateStatus(const vec2& playerPos) {
-    // Update line of sight status
-    statusHasLineOfSight = hasLineOfSight(getPosition(), playerPos);
+/**
+ * @brief Refreshes the status flags from the side's snapshot
+ * @param index this enemy's index in the side's enemy list, which the snapshot's per enemy entries follow
+ */
+void Enemy::updateStatus(const SideSnapshot& snapshot, uint index) {
+    // Update line of sight status, computed for the whole side at once
+    statusHasLineOfSight = snapshot.lineOfSight[index];
     
     // Update weapon ready status
     statusWeaponReady = (weapon != nullptr) && weapon->isReady();
     
-    // Update number of enemies on the same side (count alive enemies)
-    statusNumEnemiesOnSide = 0;
-    if (side != nullptr) {
-        auto& enemies = side->getEnemies();
-        for (Enemy* e : enemies) {
-            if (e != nullptr && !e->isDead()) {
-                statusNumEnemiesOnSide++;
-            }
-        }
-    }
+    // Update number of enemies on the same side, counted once for the side
+    statusNumEnemiesOnSide = snapshot.aliveEnemies;
     
     // Update attack capability status (weapon ready, player is in range, and level entry delay expired)
-    bool inRange = false;
-    if (weapon != nullptr) {
-        float distance = glm::length(playerPos - getPosition());
-        inRange = distance <= weapon->getRange();
-    }
+    statusPlayerDistance = snapshot.playerDistances[index];
+    bool inRange = (weapon != nullptr) && statusPlayerDistance <= weapon->getRange();
     statusCanAttack = statusWeaponReady && inRange && (levelEntryDelayTimer <= 0.0f);
     
     // Update attacking status (currently playing attack animation)
@@ -73,7 +70,9 @@ void Enemy::updateStatus(const vec2& playerPos) {
     statusHasPath = path.size() > 0;
 }
 
-void Enemy::move(const vec2& playerPos, float dt) {
+void Enemy::move(const SideSnapshot& snapshot, float dt) {
+    const vec2& playerPos = snapshot.playerPos;
+
     animator->update();
     
     // Update weapon cooldown
@@ -130,7 +129,7 @@ void Enemy::move(const vec2& playerPos, float dt) {
     // Use behaviorSelector to get the behavior, then update it
     Behavior* selectedBehavior = behaviorSelector(playerPos, dt);
     if (selectedBehavior != nullptr) {
-        selectedBehavior->update(this, playerPos, dt);
+        selectedBehavior->update(this, snapshot, dt);
     } else {
         // Fallback if no behavior selected
         moveDir = { 0, 0 };
@@ -8,6 +8,7 @@
 #include "character/moveAction.h"
 #include "resource/animation.h"
 #include "resource/animator.h"
+#include "levels/sideSnapshot.h"
 #include <optional>
 
 class Game;
@@ -53,6 +54,9 @@ private:
     AttackAction* attackAction = nullptr;  // Action that performs the attack
     MoveAction* moveAction = nullptr;  // Action that applies movement toward a destination
     std::optional<vec2> customDestination;  // Optional custom destination (if set, updatePathing will skip this enemy)
+    uint64_t pathRequest = 0;  // Outstanding PathWorkers request, 0 if none
+    float pathAge = 0.0f;  // Time since the path was last refreshed
+    int pathTargetTriangle = -1;  // Navmesh triangle of the target when the path was last refreshed
     
     // Status flags (updated by updateStatus)
     bool statusHasLineOfSight = false;
@@ -61,6 +65,7 @@ private:
     bool statusHasPath = false;
     int statusNumEnemiesOnSide = 0;
     bool statusWeaponReady = false;
+    float statusPlayerDistance = 0.0f;
 
 public:
     Enemy(Game* game, int health, float speed, Node2D* node, SingleSide* side, Weapon* weapon, AI* ai, float radius, vec2 scale, std::string hitSound = "hit", float attackDelay = 0.0f);
@@ -68,11 +73,15 @@ public:
 
     void onDamage(int damage) override;
     void onDeath() override;
-    void updateStatus(const vec2& playerPos);
-    virtual void move(const vec2& playerPos, float dt);
+    void updateStatus(const SideSnapshot& snapshot, uint index);
+    virtual void move(const SideSnapshot& snapshot, float dt);
     void attack(const vec2& playerPos, float dt);
 
     void setPath(std::vector<vec2> path) { this->path = path; }
+    uint64_t getPathRequest() const { return pathRequest; }
+    void setPathRequest(uint64_t handle) { pathRequest = handle; }
+    float& getPathAge() { return pathAge; }
+    int& getPathTargetTriangle() { return pathTargetTriangle; }
     std::vector<vec2>& getPath() { return path; }
     AI* getAI() { return ai; }
     float getFinishRadius() const { return finishRadius; }
@@ -114,6 +123,7 @@ public:
     bool hasPathStatus() const { return statusHasPath; }
     int numEnemiesOnSideStatus() const { return statusNumEnemiesOnSide; }
     bool weaponReadyStatus() const { return statusWeaponReady; }
+    float playerDistanceStatus() const { return statusPlayerDistance; }
     
     void updateNode(Node2D* newNode); // Update both the Character's node and the animator's node
 };
@@ -132,10 +132,9 @@ void Game::update(float dt) {
     }
 
     // pathing
-    pathTimer -= dt;
-    if (paper && pathTimer < 0) {
-        paper->updatePathing(player->getPosition());
-        pathTimer = maxPathTimer;
+    if (paper) {
+        paper->deliverPaths();
+        paper->updatePathing(player->getPosition(), dt);
     }
 
     // get mouse statewa
@@ -359,13 +358,7 @@ void Game::update(float dt) {
     if (currentSide) {
         // Always update game scene if it exists (unless menus are active)
         if (!MenuManager::Get().hasActiveMenu()) {
-            if (player != nullptr) {
-                currentSide->update(player->getPosition(), dt, player);
-                paper->getBackSide()->update({-100, -100}, dt); // player isn't on that side
-            } else {
-                currentSide->update({0, 0}, dt);
-                paper->getBackSide()->update({-100, -100}, dt);
-            }
+            updateSides(player != nullptr ? player->getPosition() : vec2(0, 0), dt);
             
             // Check if all enemies are defeated and set isOpen
             if (paper) {
@@ -420,6 +413,33 @@ void Game::update(float dt) {
     engine->render();
 }
 
+/**
+ * @brief Simulates both sides of the paper. The sides share no scene, enemies or zones, so the back side runs on a worker
+ * while the current side, which owns the player and boss, stays on this thread. Both then sync here, one at a time,
+ * which is where boss hits, queued sounds, node creation and deletion, and the scene steps are applied.
+ */
+void Game::updateSides(const vec2& playerPos, float dt) {
+    SingleSide* backSide = paper->getBackSide();
+
+    if (!parallelSides || backSide == currentSide) {
+        currentSide->update(playerPos, dt, player);
+        backSide->update({-100, -100}, dt); // player isn't on that side
+        return;
+    }
+
+    audio::SFXPlayer::Get().BeginDeferred();
+    sideWorkers.submit([backSide, dt]() {
+        backSide->simulate({-100, -100}, dt);
+    });
+    currentSide->simulate(playerPos, dt, player);
+    sideWorkers.wait();
+
+    // synchronization point, neither side is simulating
+    currentSide->sync();
+    backSide->sync();
+    audio::SFXPlayer::Get().EndDeferred();
+}
+
 void Game::setPaper(std::string str) { 
     this->paper = Paper::templates[str](0.0f);  // Use 0.0f difficulty for debug/test
     this->currentSide = this->paper->getSingleSide();
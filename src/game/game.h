@@ -12,6 +12,7 @@
 #include "resource/animator.h"
 #include "resource/animation.h"
 #include "game/paperView.h"
+#include "util/threadPool.h"
 #include <memory>
 
 class Floor;
@@ -73,10 +74,6 @@ private:
     // player animator
     Animator* playerAnimator;
 
-    // enemy data
-    float pathTimer = 0;
-    float maxPathTimer = 0.2;
-    
     // boss visibility
     bool showBoss = true;
 
@@ -90,6 +87,20 @@ private:
     // TODO maybe nove these to ui scenes
     std::vector<UIElement*> uiElements;
 
+    // the back side of the paper simulates here while the current side runs on the main thread.
+    // Sides create and delete nodes only in sync, on this thread
+    ThreadPool sideWorkers{ 1 };
+    bool parallelSides = true;
+
+    // read only asset lookup, a missing name gives null instead of inserting
+    template <typename T>
+    static T* lookup(const std::unordered_map<std::string, T*>& assets, const std::string& name) {
+        auto it = assets.find(name);
+        return it != assets.end() ? it->second : nullptr;
+    }
+
+    void updateSides(const vec2& playerPos, float dt);
+
 public:
     Game();
     ~Game();
@@ -105,11 +116,11 @@ public:
     void addUI(UIElement* uiElement) { this->uiElements.push_back(uiElement); }
     
     // getters
-    Image* getImage(std::string name)       { return images[name]; }
-    Material* getMaterial(std::string name) { return materials[name]; }
-    Animation* getAnimation(std::string name) { return animations[name]; }
-    Mesh* getMesh(std::string name)         { return meshes[name]; }
-    Collider* getCollider(std::string name) { return currentSide->colliders[name]; }
+    Image* getImage(const std::string& name) const         { return lookup(images, name); }
+    Material* getMaterial(const std::string& name) const   { return lookup(materials, name); }
+    Animation* getAnimation(const std::string& name) const { return lookup(animations, name); }
+    Mesh* getMesh(const std::string& name) const           { return lookup(meshes, name); }
+    Collider* getCollider(const std::string& name) const { return currentSide->getCollider(name); }
     audio::AudioManager& getAudio()         { return audioManager; }
     audio::GroupHandle getMusicGroup()      { return musicGroup; }
     audio::GroupHandle getSFXGroup()        { return sfxGroup; }
@@ -124,6 +135,8 @@ public:
     Boss* getBoss() { return boss; }
     bool getShowBoss() const { return showBoss; }
     void setShowBoss(bool show) { showBoss = show; }
+    bool getParallelSides() const { return parallelSides; }
+    void setParallelSides(bool parallel) { parallelSides = parallel; }
 
     auto& getEnemies() { return currentSide->getEnemies(); }
 
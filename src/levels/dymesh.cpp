@@ -1,17 +1,22 @@
 #include "levels/dymesh.h"
+#include "util/scratch.h"
 
 DyMesh::DyMesh(const std::vector<vec2>& region, const std::vector<UVRegion>& regions) 
     : Edger(region), regions(regions) {
     ensureCCW(this->region);
 }
 
+DyMesh::DyMesh(const CowPolygon& region, const std::vector<UVRegion>& regions) 
+    : Edger(region), regions(regions) {
+    ensureCCW(this->region);
+}
+
 DyMesh::DyMesh(const std::vector<vec2>& region, Mesh* mesh) : Edger(region), regions() {
     ensureCCW(this->region);
     
     std::vector<float>& verts = mesh->getVertices();
     
-    // Group vertices into triangles, then merge into regions
-    // For now, create one UVRegion per triangle (could be optimized later)
+    // Group vertices into triangles, one UVRegion per triangle, then merge triangles sharing a UV mapping
     uint i = 0;
     while (i < verts.size()) {
         std::vector<vec2> positions;
@@ -40,6 +45,8 @@ DyMesh::DyMesh(const std::vector<vec2>& region, Mesh* mesh) : Edger(region), reg
         
         regions.emplace_back(positions, basis, originUV);
     }
+
+    coalesceRegions();
 }
 
 DyMesh::DyMesh(const std::vector<vec2>& region) : Edger(region), regions() {
@@ -74,139 +81,200 @@ DyMesh::DyMesh(const std::vector<vec2>& region) : Edger(region), regions() {
     regions.emplace_back(region, basis, originUV);
 }
 
+/**
+ * @brief Cuts the clip region out of the mesh (or keeps only the overlap with useIntersection). The clip is 
+ * converted once and every boolean runs through one Clipper64, regions whose bounds miss the clip are 
+ * kept or dropped without clipping.
+ */
 bool DyMesh::cut(const std::vector<vec2>& clipRegion, bool useIntersection) {
     if (clipRegion.empty()) return false;
 
-    // Take snapshot of current state for UV sampling
-    DyMesh snapshot = *this;
+    Paths64 clip = makePaths64FromRegion(clipRegion);
+    auto [clipMin, clipMax] = polygonBounds(clipRegion);
+    ClipType clipType = useIntersection ? ClipType::Intersection : ClipType::Difference;
+
+    Clipper64 clipper;
+    clipper.PreserveCollinear(false);
+    auto clipPaths = [&](const Path64& subj, Paths64& sol) {
+        clipper.Clear();
+        clipper.AddSubject({ subj });
+        clipper.AddClip(clip);
+        sol.clear();
+        clipper.Execute(clipType, FillRule::NonZero, sol);
+    };
 
     // Update outer region boundary
-    Paths64 subjAll = makePaths64FromRegion(region);
-    Paths64 clip = makePaths64FromRegion(clipRegion);
-    Paths64 sol = useIntersection ? Intersect(subjAll, clip, FillRule::NonZero) 
-                                  : Difference(subjAll, clip, FillRule::NonZero);
+    Paths64 sol;
+    clipPaths(getFixedRegion(), sol);
 
     // Note: sol.size() > 1 means the cut created multiple pieces.
-    // makeRegionFromPaths64 will return the largest piece, which is typically
-    // the main region we want to keep.
-    std::vector<vec2> newRegion = makeRegionFromPaths64(sol);
-
-    if (newRegion.size() < 3) {
+    // The largest piece is typically the main region we want to keep.
+    if (sol.empty()) {
         region.clear();
         regions.clear();
         return true;
     }
 
+    Path64 newRegion = std::move(sol[largestPath(sol)]);
     ensureCCW(newRegion);
 
     // Process each UV region
     std::vector<UVRegion> newRegions;
-    
-    // Helper function to check if point is inside polygon
-    auto pointInPolygon = [](const vec2& p, const std::vector<vec2>& polygon) -> bool {
-        if (polygon.size() < 3) return false;
-        bool inside = false;
-        for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++) {
-            const vec2& a = polygon[i];
-            const vec2& b = polygon[j];
-            bool intersect = ((a.y > p.y) != (b.y > p.y)) &&
-                            (p.x < (b.x - a.x) * (p.y - a.y) / (b.y - a.y + 1e-12f) + a.x);
-            if (intersect) inside = !inside;
-        }
-        return inside;
-    };
-    
-    for (const UVRegion& uvReg : snapshot.regions) {
-        // For obstacles, check if they intersect with the clip region
-        // If they do, they need to be clipped (even if all vertices are inside the new region)
-        // This allows obstacles to be split when folded over
-        if (uvReg.isObstacle) {
-            // Check if obstacle intersects with clip region
-            Paths64 obstaclePath = makePaths64FromRegion(uvReg.positions);
-            Paths64 clipPaths = makePaths64FromRegion(clipRegion);
-            Paths64 intersectionTest;
-            
-            try {
-                intersectionTest = Intersect(obstaclePath, clipPaths, FillRule::NonZero);
-            } catch (...) {
-                intersectionTest.clear();
-            }
-            
-            bool intersectsClipRegion = false;
-            if (!intersectionTest.empty()) {
-                for (const Path64& p : intersectionTest) {
-                    if (Area(p) > 0) {
-                        intersectsClipRegion = true;
-                        break;
-                    }
-                }
-            }
-            
-            // Only preserve obstacle as-is if:
-            // 1. All vertices are inside the new region AND
-            // 2. It does NOT intersect with the clip region (not being split)
-            if (!intersectsClipRegion) {
-                bool obstacleInside = true;
-                for (const vec2& pos : uvReg.positions) {
-                    if (!pointInPolygon(pos, newRegion)) {
-                        obstacleInside = false;
-                        break;
-                    }
-                }
-                if (obstacleInside) {
-                    // Preserve obstacle as-is if it's inside the new boundary and not being split
-                    newRegions.push_back(uvReg);
-                    continue;
-                }
-            }
-            // If obstacle intersects clip region or is partially outside, clip it
+    newRegions.reserve(regions.size());
+
+    Paths64 regionSol;
+    bool split = false;
+    for (const UVRegion& uvReg : regions) {
+        // Regions away from the clip are untouched by a difference and vanish in an intersection
+        auto [regMin, regMax] = polygonBounds(uvReg.positions);
+        bool overlapsClip = regMin.x <= clipMax.x && regMax.x >= clipMin.x && regMin.y <= clipMax.y && regMax.y >= clipMin.y;
+        if (!overlapsClip) {
+            if (!useIntersection) newRegions.push_back(uvReg);
+            continue;
         }
-        
-        Paths64 subj = makePaths64FromRegion(uvReg.positions);
-        Paths64 clipPaths = makePaths64FromRegion(clipRegion);
-        Paths64 regionSol;
+
+        const Path64& subj = uvReg.getFixedPositions();
 
         try {
-            regionSol = useIntersection ? Intersect(subj, clipPaths, FillRule::NonZero)
-                                       : Difference(subj, clipPaths, FillRule::NonZero);
+            clipPaths(subj, regionSol);
         } catch (...) {
             continue;
         }
 
         if (regionSol.empty()) continue;
 
-        // Each path is a clipped piece
-        for (const Path64& path : regionSol) {
-            std::vector<vec2> clippedPositions;
-            clippedPositions.reserve(path.size());
-            
-            for (const Point64& pt : path) {
-                clippedPositions.emplace_back(
-                    static_cast<float>(pt.x / CLIPPER_SCALE),
-                    static_cast<float>(pt.y / CLIPPER_SCALE)
-                );
+        // Obstacles the clip only grazes are preserved as-is, anything actually split is rebuilt
+        // so obstacles can be split when folded over
+        if (uvReg.isObstacle && !useIntersection && regionSol.size() == 1) {
+            double before = std::abs(Area(subj));
+            double after = std::abs(Area(regionSol[0]));
+            if (std::abs(before - after) <= before * 1e-9) {
+                newRegions.push_back(uvReg);
+                continue;
             }
-            
-            clippedPositions = simplifyCollinear(clippedPositions);
-            if (clippedPositions.size() < 3) continue;
-            
-            ensureCCW(clippedPositions);
+        }
+
+        // Each path is a clipped piece, kept in fixed point so the next cut starts from exactly this output
+        for (Path64& path : regionSol) {
+            ensureCCW(path);
+
+            UVRegion piece({}, uvReg.basis, vec2(0.0f), uvReg.isObstacle);
+            piece.setFixedPositions(std::move(path));
+            if (piece.positions.size() < 3) continue;
 
             // Preserve basis from original region, compute new originUV for new origin position
-            vec2 newOriginUV = uvReg.sampleUV(clippedPositions[0]);
-            newRegions.emplace_back(clippedPositions, uvReg.basis, newOriginUV, uvReg.isObstacle);
+            piece.originUV = uvReg.sampleUV(piece.positions[0]);
+            newRegions.push_back(std::move(piece));
+            split = true;
         }
     }
 
-    region = std::move(newRegion);
+    setFixedRegion(std::move(newRegion));
     regions = std::move(newRegions);
+    invalidateRegionTree();
+
+    // fragments of a cut can often be joined back with neighbours that sample the same way
+    if (split) coalesceRegions();
     
-    region = simplifyCollinear(region);
     pruneDups();
 
     return true;
 }
 
+/**
+ * @brief Unions every group of non-obstacle regions with the same UV mapping. A group stays as it was if 
+ * the union has holes (a UVRegion cannot hold one) or joins nothing. Merged regions take the place of 
+ * the group's first region.
+ */
+void DyMesh::coalesceRegions() {
+    const float mapEps = 1e-5f;
+    regionsBeforeCoalesce = regions.size();
+
+    struct Group {
+        mat2x2 m;
+        vec2 c;
+        std::vector<uint> members;
+    };
+    ScratchScope scratch;
+    std::vector<Group> groups;
+    std::pmr::vector<int> groupOf(regions.size(), -1, scratch.resource());
+
+    for (uint i = 0; i < regions.size(); i++) {
+        const UVRegion& uvReg = regions[i];
+        mat2x2 m;
+        vec2 c;
+        if (uvReg.isObstacle || uvReg.positions.size() < 3 || !uvReg.uvMap(m, c)) continue;
+
+        auto close = [&](const Group& g) {
+            return glm::all(glm::epsilonEqual(g.m[0], m[0], mapEps)) 
+                && glm::all(glm::epsilonEqual(g.m[1], m[1], mapEps)) 
+                && glm::all(glm::epsilonEqual(g.c, c, mapEps));
+        };
+        auto found = std::find_if(groups.begin(), groups.end(), close);
+        if (found == groups.end()) {
+            groups.push_back({ m, c, {} });
+            found = groups.end() - 1;
+        }
+        found->members.push_back(i);
+        groupOf[i] = found - groups.begin();
+    }
+
+    if (groups.size() == regionsBeforeCoalesce) {
+        regionsAfterCoalesce = regionsBeforeCoalesce;
+        return;
+    }
+
+    std::vector<UVRegion> newRegions;
+    newRegions.reserve(regions.size());
+
+    Clipper64 clipper;
+    clipper.PreserveCollinear(false);
+    Paths64 sol;
+    for (uint i = 0; i < regions.size(); i++) {
+        if (groupOf[i] == -1 || groups[groupOf[i]].members.size() < 2) {
+            newRegions.push_back(std::move(regions[i]));
+            continue;
+        }
+
+        // the whole group is written when its first member comes up
+        const Group& group = groups[groupOf[i]];
+        if (group.members[0] != i) continue;
+
+        clipper.Clear();
+        for (uint member : group.members) {
+            clipper.AddSubject({ regions[member].getFixedPositions() });
+        }
+        sol.clear();
+        try {
+            clipper.Execute(ClipType::Union, FillRule::NonZero, sol);
+        } catch (...) {
+            sol.clear();
+        }
+
+        bool hasHole = std::any_of(sol.begin(), sol.end(), [](const Path64& path) { return Area(path) < 0.0; });
+        if (sol.empty() || hasHole || sol.size() >= group.members.size()) {
+            for (uint member : group.members) {
+                newRegions.push_back(std::move(regions[member]));
+            }
+            continue;
+        }
+
+        const UVRegion& first = regions[i];
+        for (Path64& path : sol) {
+            UVRegion merged({}, first.basis, vec2(0.0f), false);
+            merged.setFixedPositions(std::move(path));
+            if (merged.positions.size() < 3) continue;
+
+            merged.originUV = first.sampleUV(merged.positions[0]);
+            newRegions.push_back(std::move(merged));
+        }
+    }
+
+    regions = std::move(newRegions);
+    regionsAfterCoalesce = regions.size();
+    invalidateRegionTree();
+}
+
 bool DyMesh::cut(const DyMesh& other, bool useIntersection) {
     return cut(other.region, useIntersection);
 }
@@ -232,6 +300,7 @@ bool DyMesh::copy(const DyMesh& other) {
 
     this->regions = temp.regions;
     this->region = temp.region;
+    invalidateRegionTree();
 
     return true;
 }
@@ -243,19 +312,30 @@ bool DyMesh::paste(const DyMesh& other, int expected) {
     for (const UVRegion& uvReg : other.regions) {
         regions.push_back(uvReg);
     }
+    invalidateRegionTree();
 
     // Update outer boundary to union
-    Paths64 a = makePaths64FromRegion(this->region);
-    Paths64 b = makePaths64FromRegion(other.region);
+    Paths64 a = { getFixedRegion() };
+    Paths64 b = { other.getFixedRegion() };
 
     Paths64 unionSol;
     try {
-        unionSol = Union(a, b, FillRule::NonZero);
+        Clipper64 clipper;
+        clipper.PreserveCollinear(false);
+        clipper.AddSubject(a);
+        clipper.AddClip(b);
+        clipper.Execute(ClipType::Union, FillRule::NonZero, unionSol);
     } catch (...) {
         return false;
     }
 
-    std::vector<vec2> newRegion = makeRegionFromPaths64(unionSol);
+    CowPolygon newRegion;
+    FixedPolygon newFixed;
+    if (!unionSol.empty()) {
+        Path64& largest = unionSol[largestPath(unionSol)];
+        ensureCCW(largest);
+        newFixed.set(std::move(largest), newRegion);
+    }
 
     if (newRegion.size() < 3) {
         if (expected > 0) {
@@ -266,14 +346,12 @@ bool DyMesh::paste(const DyMesh& other, int expected) {
         return true;
     }
 
-    ensureCCW(newRegion);
-
     if (expected != -1 && newRegion.size() != expected) {
         return false;
     }
 
     region = std::move(newRegion);
-    region = simplifyCollinear(region);
+    fixedRegion = std::move(newFixed);
     pruneDups();
 
     return true;
@@ -334,76 +412,162 @@ DyMesh* DyMesh::mirror(const vec2& pos, const vec2& dir) {
 bool DyMesh::sampleUV(const vec2& pos, vec2& uv) const {
     const float eps = 1e-6f;
     float minDistance = std::numeric_limits<float>::max();
-    vec2 closestUV;
+    uint closest = 0;
     bool found = false;
 
-    for (const UVRegion& uvReg : regions) {
-        float dist = uvReg.distance(pos);
-        if (dist < minDistance) {
+    // Only regions whose bounds are within eps can be close enough, ties go to the earliest region
+    forRegionsNear(pos, eps, [&](uint index) {
+        float dist = regions[index].distance(pos);
+        if (dist < minDistance || (dist == minDistance && index < closest)) {
             minDistance = dist;
-            closestUV = uvReg.sampleUV(pos);
+            closest = index;
             found = true;
         }
-    }
+        return false;
+    });
 
     if (found && minDistance <= eps) {
-        uv = closestUV;
+        uv = regions[closest].sampleUV(pos);
         return true;
     }
 
     return false;
 }
 
+/**
+ * @brief Concatenates the triangulated blocks of every region, only regions changed since the last 
+ * export are re-triangulated
+ */
 void DyMesh::toData(std::vector<float>& exp) {
     exp.clear();
     
     // Estimate capacity (assume ~2 triangles per region on average)
     exp.reserve(regions.size() * 2 * 3 * 5);
 
+    lastRetriangulated = 0;
     for (const UVRegion& uvReg : regions) {
-        if (uvReg.positions.size() < 3) continue;
+        bool rebuilt;
+        const std::vector<float>& block = uvReg.getMeshData(rebuilt);
+        if (rebuilt) lastRetriangulated++;
+        exp.insert(exp.end(), block.begin(), block.end());
+    }
 
-        // Triangulate region
-        std::vector<std::vector<std::array<double, 2>>> polygon;
-        polygon.emplace_back();
-        polygon[0].reserve(uvReg.positions.size());
-        
-        for (const vec2& v : uvReg.positions) {
-            polygon[0].push_back({{static_cast<double>(v.x), static_cast<double>(v.y)}});
-        }
+    lastExportedRegions = regions.size();
+    totalRetriangulated += lastRetriangulated;
+    totalExportedRegions += lastExportedRegions;
+}
 
-        std::vector<uint32_t> indices = mapbox::earcut<uint32_t>(polygon);
+bool DyMesh::contains(const vec2& pos) const {
+    return forRegionsNear(pos, EPSILON, [&](uint index) {
+        return regions[index].contains(pos);
+    });
+}
 
-        // Generate triangles
-        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
-            for (int j = 0; j < 3; j++) {
-                uint32_t idx = indices[i + j];
-                const vec2& pos = uvReg.positions[idx];
-                vec2 uv = uvReg.sampleUV(pos);
+/**
+ * @brief contains() for many points, each region tests the points in its bounds that no earlier region claimed in one batch
+ */
+void DyMesh::containsMany(std::span<const vec2> points, std::span<uint8_t> out) const {
+    size_t count = std::min(points.size(), out.size());
+    std::fill(out.begin(), out.begin() + count, 0);
+    if (count == 0) return;
 
-                exp.push_back(pos.x);
-                exp.push_back(-pos.y);
-                exp.push_back(0.0f);
-                exp.push_back(uv.x);
-                exp.push_back(-uv.y);
-            }
+    if (regionTreeDirty || regionBounds.size() != regions.size()) {
+        buildRegionTree();
+    }
+
+    ScratchScope scratch;
+    std::pmr::vector<vec2> batch(scratch.resource());
+    std::pmr::vector<uint> batchIndex(scratch.resource());
+    std::pmr::vector<uint8_t> batchOut(scratch.resource());
+    batch.reserve(count);
+    batchIndex.reserve(count);
+
+    for (uint r = 0; r < regions.size(); r++) {
+        const auto& [lo, hi] = regionBounds[r];
+
+        batch.clear();
+        batchIndex.clear();
+        for (uint i = 0; i < count; i++) {
+            const vec2& pos = points[i];
+            if (out[i] || pos.x < lo.x - EPSILON || pos.y < lo.y - EPSILON || pos.x > hi.x + EPSILON || pos.y > hi.y + EPSILON) continue;
+            batch.push_back(pos);
+            batchIndex.push_back(i);
+        }
+        if (batch.empty()) continue;
+
+        batchOut.resize(batch.size());
+        regions[r].containsMany(batch, batchOut);
+        for (size_t j = 0; j < batch.size(); j++) {
+            if (batchOut[j]) out[batchIndex[j]] = 1;
         }
     }
 }
 
-bool DyMesh::contains(const vec2& pos) const {
-    for (const UVRegion& uvReg : regions) {
-        if (uvReg.contains(pos)) return true;
+bool DyMesh::obstacleContains(const vec2& pos) const {
+    return forRegionsNear(pos, EPSILON, [&](uint index) {
+        return regions[index].isObstacle && regions[index].contains(pos);
+    });
+}
+
+/**
+ * @brief Caches every region's bounds and builds the tree by median splits along the longest axis
+ */
+void DyMesh::buildRegionTree() const {
+    regionTreeDirty = false;
+    regionTree.clear();
+    regionBounds.resize(regions.size());
+    regionOrder.resize(regions.size());
+
+    for (uint i = 0; i < regions.size(); i++) {
+        regionBounds[i] = polygonBounds(regions[i].positions);
+        regionOrder[i] = i;
     }
-    return false;
+
+    if (regions.empty()) return;
+
+    regionTree.reserve(2 * regions.size() / REGION_LEAF_SIZE + 1);
+    buildRegionNode(0, regions.size());
+}
+
+uint DyMesh::buildRegionNode(uint start, uint count) const {
+    uint index = regionTree.size();
+    regionTree.emplace_back();
+
+    vec2 lo = vec2{ std::numeric_limits<float>::infinity() };
+    vec2 hi = vec2{ -std::numeric_limits<float>::infinity() };
+    for (uint i = start; i < start + count; i++) {
+        lo = glm::min(lo, regionBounds[regionOrder[i]].first);
+        hi = glm::max(hi, regionBounds[regionOrder[i]].second);
+    }
+    regionTree[index].lo = lo;
+    regionTree[index].hi = hi;
+
+    if (count <= REGION_LEAF_SIZE) {
+        regionTree[index].start = start;
+        regionTree[index].count = count;
+        return index;
+    }
+
+    // Split on the median region center along the longest axis
+    int axis = (hi.x - lo.x) >= (hi.y - lo.y) ? 0 : 1;
+    uint half = count / 2;
+    auto first = regionOrder.begin() + start;
+    std::nth_element(first, first + half, first + count, [&](uint a, uint b) {
+        return regionBounds[a].first[axis] + regionBounds[a].second[axis] < regionBounds[b].first[axis] + regionBounds[b].second[axis];
+    });
+
+    buildRegionNode(start, half);
+    uint right = buildRegionNode(start + half, count - half);
+    regionTree[index].right = right;
+    return index;
 }
 
 bool DyMesh::hasOverlap(const DyMesh& other) const {
     if (region.size() < 3 || other.region.size() < 3)
         return false;
 
-    Paths64 subj = makePaths64FromRegion(region);
-    Paths64 clip = makePaths64FromRegion(other.region);
+    Paths64 subj = { getFixedRegion() };
+    Paths64 clip = { other.getFixedRegion() };
     Paths64 sol;
 
     try {
@@ -442,9 +606,28 @@ void DyMesh::removeDataOutside() {
     // Could implement region filtering here if needed
 }
 
+/**
+ * @brief Frees everything derived from the outline and regions, for meshes that are stored but rarely queried
+ */
+void DyMesh::dropCaches() {
+    fixedRegion.path.reset();
+    for (UVRegion& uvReg : regions) {
+        uvReg.fixed.path.reset();
+        uvReg.meshData.reset();
+        uvReg.meshDataVersion = 0;
+    }
+    regions.shrink_to_fit();
+
+    regionTree = {};
+    regionOrder = {};
+    regionBounds = {};
+    invalidateRegionTree();
+}
+
 void DyMesh::flipHorizontal() {
     Edger::flipHorizontal();
     for (UVRegion& uvReg : regions) {
         uvReg.flipHorizontal();
     }
+    invalidateRegionTree();
 }
\ No newline at end of file
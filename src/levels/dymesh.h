@@ -11,8 +11,42 @@
 struct DyMesh : public Edger {
     std::vector<UVRegion> regions;  // Independent UV regions that compose the mesh
 
+private:
+    // Flat AABB tree over regions. Leaves cover regionOrder[start, start + count), internal nodes have 
+    // count == 0 with their left child right after them and the right child at index right
+    struct RegionNode {
+        vec2 lo;
+        vec2 hi;
+        uint start = 0;
+        uint count = 0;
+        uint right = 0;
+    };
+
+    static constexpr uint REGION_LEAF_SIZE = 4;
+
+    mutable std::vector<RegionNode> regionTree;
+    mutable std::vector<uint> regionOrder;
+    mutable std::vector<std::pair<vec2, vec2>> regionBounds; // per region, indexed like regions
+    mutable bool regionTreeDirty = true;
+
+    void buildRegionTree() const;
+    uint buildRegionNode(uint start, uint count) const;
+
+    // toData triangulation cache stats
+    uint lastRetriangulated = 0;
+    uint lastExportedRegions = 0;
+    uint64_t totalRetriangulated = 0;
+    uint64_t totalExportedRegions = 0;
+
+    // coalesceRegions stats
+    uint regionsBeforeCoalesce = 0;
+    uint regionsAfterCoalesce = 0;
+
+public:
+
     DyMesh(const std::vector<vec2>& region, Mesh* mesh);
     DyMesh(const std::vector<vec2>& region, const std::vector<UVRegion>& regions);
+    DyMesh(const CowPolygon& region, const std::vector<UVRegion>& regions);  // shares the polygon buffers
     DyMesh(const std::vector<vec2>& region);  // Create single region with default UVs
 
     // Modifier functions
@@ -21,9 +55,20 @@ struct DyMesh : public Edger {
     bool copy(const DyMesh& other);  // Copy UVs from overlapping regions
     bool paste(const DyMesh& other, int expected = -1);  // Paste aligned mesh
 
+    // Merges adjacent non-obstacle regions that map positions to UVs the same way
+    void coalesceRegions();
+    std::pair<uint, uint> getCoalesceCounts() const { return { regionsBeforeCoalesce, regionsAfterCoalesce }; } // region count before and after the last merge
+
+    // Region tree, rebuilt on the next query after the regions change. Changes made outside DyMesh 
+    // that keep the region count must call invalidateRegionTree()
+    void invalidateRegionTree() { regionTreeDirty = true; }
+    template <typename Visit> bool forRegionsNear(const vec2& pos, float eps, Visit&& visit) const;
+
     // Collision checks
     bool hasOverlap(const DyMesh& other) const;
     bool contains(const vec2& pos) const;
+    void containsMany(std::span<const vec2> points, std::span<uint8_t> out) const; // out[i] = contains(points[i])
+    bool obstacleContains(const vec2& pos) const;
     bool sampleUV(const vec2& pos, vec2& uv) const;
     bool sampleUV(const Vert& v, vec2& uv) const { return sampleUV(v.pos, uv); }
     
@@ -32,10 +77,51 @@ struct DyMesh : public Edger {
 
     // Export
     void toData(std::vector<float>& exp);
+    float getRetriangulatedFraction() const { return lastExportedRegions ? (float)lastRetriangulated / lastExportedRegions : 0.0f; }
+    float getTotalRetriangulatedFraction() const { return totalExportedRegions ? (float)totalRetriangulated / totalExportedRegions : 0.0f; }
     void printData();
 
     // Cleaning
     void removeDataOutside();
+    void dropCaches(); // frees fixed point copies, triangulations and the region tree, all rebuilt on demand
 };
 
+/**
+ * @brief Calls visit(index) for every region whose bounds lie within eps of pos, stopping early if visit returns true
+ * @return true if a visit stopped the search
+ */
+template <typename Visit>
+bool DyMesh::forRegionsNear(const vec2& pos, float eps, Visit&& visit) const {
+    if (regionTreeDirty || regionBounds.size() != regions.size()) {
+        buildRegionTree();
+    }
+    if (regionTree.empty()) return false;
+
+    uint stack[64];
+    uint top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const RegionNode& node = regionTree[stack[--top]];
+        if (pos.x < node.lo.x - eps || pos.y < node.lo.y - eps || pos.x > node.hi.x + eps || pos.y > node.hi.y + eps) {
+            continue;
+        }
+
+        if (node.count > 0) {
+            for (uint i = node.start; i < node.start + node.count; i++) {
+                uint index = regionOrder[i];
+                const auto& [lo, hi] = regionBounds[index];
+                if (pos.x < lo.x - eps || pos.y < lo.y - eps || pos.x > hi.x + eps || pos.y > hi.y + eps) continue;
+                if (visit(index)) return true;
+            }
+            continue;
+        }
+
+        uint self = &node - regionTree.data();
+        stack[top++] = node.right;
+        stack[top++] = self + 1;
+    }
+
+    return false;
+}
+
 #endif
\ No newline at end of file
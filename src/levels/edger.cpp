@@ -1,7 +1,9 @@
 #include "edger.h"
 #include <stdexcept>
 
-Edger::Edger(const std::vector<vec2> region) : region(region) {}
+Edger::Edger(const std::vector<vec2>& region) : region(region) {}
+
+Edger::Edger(const CowPolygon& region) : region(region) {}
 
 vec2 Edger::getNearestEdgeIntersection(const vec2& pos, const vec2& dir) {
     float closestT = std::numeric_limits<float>::max();
@@ -211,6 +213,40 @@ void Edger::addRangeOutside(std::vector<vec2>& unreflected, int a, int b) {
 }
 
 // testing functions
+/**
+ * @brief Outline of the flap a fold would lift, reflected over the crease. Picks the same vertex range and crease 
+ * points as Fold::initialize but skips the booleans, so it only matches the real cover where the back side 
+ * has no extra cuts.
+ */
+bool Edger::getFoldCover(const vec2& creasePos, const vec2& foldDir, const vec2& searchStart, std::vector<vec2>& cover) {
+    cover.clear();
+
+    float midDot = glm::dot(creasePos, foldDir);
+    vec2 creaseDir = { foldDir.y, -foldDir.x };
+
+    std::pair<int, int> indexBounds;
+    if (!getVertexRangeBelowThreshold(foldDir, midDot, searchStart, indexBounds)) {
+        return false;
+    }
+
+    vec2 foldStart, foldEnd;
+    if (!getEdgeIntersection(indexBounds.first - 1, creasePos, creaseDir, foldStart) || 
+        !getEdgeIntersection(indexBounds.second, creasePos, creaseDir, foldEnd)) {
+        return false;
+    }
+
+    cover.push_back(foldStart);
+    addRangeInside(cover, indexBounds);
+    cover.push_back(foldEnd);
+
+    for (vec2& v : cover) {
+        v = reflectPointOverLine(creasePos, creaseDir, v);
+    }
+    ensureCCW(cover);
+
+    return true;
+}
+
 bool Edger::isPointOutside(const vec2& p, float eps) const {
     size_t n = region.size();
     if (n < 3) return true; // degenerate polygon → everything outside
@@ -270,7 +306,7 @@ void Edger::removeAll(const std::vector<vec2> removes, float epsilon) {
         }
     }
 
-    region.swap(filtered);
+    region = std::move(filtered);
 }
 
 void Edger::keepOnly(const std::vector<vec2> keeps, float epsilon) {
@@ -297,18 +333,30 @@ void Edger::keepOnly(const std::vector<vec2> keeps, float epsilon) {
         }
     }
 
-    region.swap(filtered);
+    region = std::move(filtered);
 }
 
 void Edger::pruneDups() {
     if (region.size() <= 1) return;
     
     const float eps = 1e-6f;
-    
-    for (int i = 0; i < region.size(); i++) {
-        for (int j = i + 1; j < region.size(); j++) {
-            if (glm::all(glm::epsilonEqual(region[i], region[j], eps))) {
-                region.erase(region.begin() + j);
+
+    // Scan read only first so a shared region is only copied when it actually has duplicates
+    auto hasDup = [&]() {
+        for (size_t i = 0; i < region.size(); i++) {
+            for (size_t j = i + 1; j < region.size(); j++) {
+                if (glm::all(glm::epsilonEqual(region[i], region[j], eps))) return true;
+            }
+        }
+        return false;
+    };
+    if (!hasDup()) return;
+
+    std::vector<vec2>& verts = region.edit();
+    for (int i = 0; i < verts.size(); i++) {
+        for (int j = i + 1; j < verts.size(); j++) {
+            if (glm::all(glm::epsilonEqual(verts[i], verts[j], eps))) {
+                verts.erase(verts.begin() + j);
                 j--; 
             }
         }
@@ -316,5 +364,5 @@ void Edger::pruneDups() {
 }
 
 void Edger::flipHorizontal() {
-    flipVecsHorizontal(region);
+    flipVecsHorizontal(region.edit());
 }
\ No newline at end of file
@@ -3,11 +3,17 @@
 
 #include "util/includes.h"
 #include "util/maths.h"
+#include "util/clipper_helper.h"
 
 struct Edger {
-    std::vector<vec2> region;
+    CowPolygon region; // shared with copies until edited
+    mutable FixedPolygon fixedRegion; // fixed point copy of region used by clipping
 
-    Edger(const std::vector<vec2> region);
+    Edger(const std::vector<vec2>& region);
+    Edger(const CowPolygon& region);
+
+    const Path64& getFixedRegion() const { return fixedRegion.get(region); }
+    void setFixedRegion(Path64 path) { fixedRegion.set(std::move(path), region); }
     vec2 getNearestEdgeIntersection(const vec2& pos, const vec2& dir);
     vec2 getNearestEdgePoint(const vec2& pos);
     bool getVertexRangeBelowThreshold(const vec2& dir, float thresh, const vec2& start, std::pair<int, int>& outRange);
@@ -15,6 +21,7 @@ struct Edger {
     bool getEdgeIntersection(int edgeStartIndex, const vec2& pos, const vec2& dir, vec2& out);
     void reflectVerticesOverLine(std::vector<vec2>& reflected, int a, int b, const vec2& pos, const vec2& dir);
     void addRangeOutside(std::vector<vec2>& unreflected, int a, int b);
+    bool getFoldCover(const vec2& creasePos, const vec2& foldDir, const vec2& searchStart, std::vector<vec2>& cover); // outline only, no booleans
 
     // cut specific 
     void flipHorizontal();
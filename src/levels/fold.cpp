@@ -184,4 +184,56 @@ Paper::Fold& Paper::Fold::operator=(Fold&& other) noexcept {
     other.cover = nullptr;
     
     return *this;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Bytes held by a mesh's outline and regions, shared polygon buffers are counted in full
+ */
+static size_t meshBytes(const DyMesh& mesh) {
+    size_t bytes = mesh.region.size() * sizeof(vec2) + mesh.regions.size() * sizeof(UVRegion);
+    for (const UVRegion& uvReg : mesh.regions) {
+        bytes += uvReg.positions.size() * sizeof(vec2);
+    }
+    return bytes;
+}
+
+Paper::FoldRecord::FoldRecord(const Fold& fold) :
+    underside(*fold.underside),
+    backside(*fold.backside),
+    originalFoldedVerts(fold.originalFoldedVerts),
+    holds(fold.holds),
+    side(fold.side),
+    crease(fold.crease),
+    creasePos(fold.creasePos),
+    creaseDir(fold.creaseDir)
+{
+    // the fold's meshes are freed after the push, so shared caches would otherwise live on only in the record
+    underside.dropCaches();
+    backside.dropCaches();
+
+    bytes = sizeof(FoldRecord) 
+          + meshBytes(underside) 
+          + meshBytes(backside) 
+          + originalFoldedVerts.size() * sizeof(vec2);
+}
+
+/**
+ * @brief Rebuilds the cover the same way Fold::initialize made it, the flipped backside mirrored over the crease
+ */
+DyMesh Paper::FoldRecord::makeCover() const {
+    DyMesh backFlipped = backside;
+    backFlipped.flipHorizontal();
+
+    DyMesh* mirrored = backFlipped.mirror(creasePos, creaseDir);
+    DyMesh cover = std::move(*mirrored);
+    delete mirrored;
+    return cover;
+}
+
+/**
+ * @brief Whether pos is on the cover, tested by taking pos back across the crease into the backside
+ */
+bool Paper::FoldRecord::coverContains(const vec2& pos) const {
+    vec2 mirrored = reflectPointOverLine(creasePos, creaseDir, pos);
+    return backside.contains({ -mirrored.x, mirrored.y });
+}
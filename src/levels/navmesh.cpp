@@ -1,14 +1,14 @@
 #include "levels/navmesh.h"
+#include "util/clipper_helper.h"
 #include <earcut.hpp>
+#include "util/scratch.h"
+#include <numeric>
+
+std::atomic<uint> Navmesh::nextVersion = 1;
 
 Navmesh::Triangle::Triangle(vec2& a, vec2& b, vec2& c) : Tri({ a, b, c }) {
     center = (a + b + c) / 3.0f;
-    reset();
-}
-
-void Navmesh::Triangle::reset() {
-    g = std::numeric_limits<float>::infinity();
-    f = std::numeric_limits<float>::infinity();
+    neighbors.fill(-1);
 }
 
 Navmesh::Edge Navmesh::Triangle::operator[](size_t index) const {
@@ -37,168 +37,391 @@ void Navmesh::addObstacle(std::vector<vec2> obstacleMesh) {
 void Navmesh::earcut() {
     std::vector<uint> indices;
     
-    // Use earcut with mapbox format
+    // Use earcut with mapbox format, rings are built in scratch memory
+    ScratchScope scratch;
     using Point = std::array<float, 2>;
-    std::vector<std::vector<Point>> polygonData;
+    std::pmr::vector<std::pmr::vector<Point>> polygonData(scratch.resource());
+    polygonData.reserve(rings.size());
     
     uint startIdx = 0;
     for (uint ringEnd : rings) {
-        std::vector<Point> ringData;
-        for (uint i = startIdx; i < ringEnd; i++) {
-            ringData.push_back({mesh[i].x, mesh[i].y});
-        }
-        if (!ringData.empty()) {
-            polygonData.push_back(ringData);
+        if (ringEnd > startIdx) {
+            std::pmr::vector<Point>& ringData = polygonData.emplace_back();
+            ringData.reserve(ringEnd - startIdx);
+            for (uint i = startIdx; i < ringEnd; i++) {
+                ringData.push_back({mesh[i].x, mesh[i].y});
+            }
         }
         startIdx = ringEnd;
     }
     
     indices = mapbox::earcut<uint>(polygonData);
 
+    // Rings can repeat a position, so triangles reference welded vertices for adjacency
+    std::vector<uint> weld;
+    weldVertices(mesh, weld);
+
     // Construct triangles list
     triangles.clear();
+    triangles.reserve(indices.size() / 3);
     for (uint i = 0; i < indices.size() / 3; i++) {
-        triangles.emplace_back(
-            mesh[indices[3 * i + 0]],
-            mesh[indices[3 * i + 1]],
-            mesh[indices[3 * i + 2]]
-        );
+        uint a = indices[3 * i + 0];
+        uint b = indices[3 * i + 1];
+        uint c = indices[3 * i + 2];
+        triangles.emplace_back(mesh[a], mesh[b], mesh[c]);
+        triangles.back().ids = { weld[a], weld[b], weld[c] };
+    }
+}
+
+/**
+ * @brief Maps every vertex to the first vertex sharing its position (within EPSILON)
+ * @param weld output, weld[i] is the canonical index of verts[i]
+ */
+void Navmesh::weldVertices(const std::vector<vec2>& verts, std::vector<uint>& weld) {
+    std::vector<uint> order(verts.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](uint a, uint b) { return verts[a].x < verts[b].x; });
+
+    weld.resize(verts.size());
+    std::iota(weld.begin(), weld.end(), 0);
+
+    // Sweep along x, only vertices within EPSILON in x can share a position
+    for (uint i = 0; i < order.size(); i++) {
+        uint a = order[i];
+        if (weld[a] != a) {
+            continue;
+        }
+
+        for (uint j = i + 1; j < order.size() && verts[order[j]].x - verts[a].x < EPSILON; j++) {
+            uint b = order[j];
+            if (weld[b] == b && std::abs(verts[b].y - verts[a].y) < EPSILON) {
+                weld[b] = a;
+            }
+        }
     }
 }
 
 /**
- * @brief Initializes the triangle-edge graph using the data stored about the individual triangles. 
+ * @brief Initializes the triangle-edge graph by pairing half-edges that share welded vertex indices. 
  * Earcut must be run before calling this function.
+ * @param vertexCount upper bound on the welded vertex indices stored in the triangles
  */
-void Navmesh::buildGraph() {
-    std::unordered_map<Edge, std::pair<uint, ushort>, EdgeHash, EdgeEqual> edgeMap;
+void Navmesh::buildGraph(uint vertexCount) {
+    // Bucket half-edges by their lower vertex index, matches are then found within a single small bucket
+    std::vector<uint> bucketStart(vertexCount + 1, 0);
+    for (Triangle& triangle : triangles) {
+        triangle.neighbors.fill(-1);
+        for (ushort edgindex = 0; edgindex < 3; edgindex++) {
+            uint lo = std::min(triangle.ids[edgindex], triangle.ids[(edgindex + 1) % 3]);
+            bucketStart[lo + 1]++;
+        }
+    }
 
-    for (uint trindex = 0; trindex < triangles.size(); trindex++) {
-        Triangle& triangle = triangles[trindex];
-        triangle.adjacency.clear();
+    for (uint v = 0; v < vertexCount; v++) {
+        bucketStart[v + 1] += bucketStart[v];
+    }
 
+    // Half-edges are encoded as 3 * triangle + edge
+    std::vector<uint> halfEdges(bucketStart.back());
+    std::vector<uint> cursor(bucketStart.begin(), bucketStart.end() - 1);
+    for (uint trindex = 0; trindex < triangles.size(); trindex++) {
+        const Triangle& triangle = triangles[trindex];
         for (ushort edgindex = 0; edgindex < 3; edgindex++) {
-            const Edge edge = triangle[edgindex];
+            uint lo = std::min(triangle.ids[edgindex], triangle.ids[(edgindex + 1) % 3]);
+            halfEdges[cursor[lo]++] = 3 * trindex + edgindex;
+        }
+    }
 
-            // Determine if edge has a match using consistent winding
-            Edge reverse = edge;
-            std::swap(reverse.first, reverse.second);
+    // Pair half-edges with the same endpoints
+    for (uint v = 0; v < vertexCount; v++) {
+        for (uint i = bucketStart[v]; i < bucketStart[v + 1]; i++) {
+            uint trindex = halfEdges[i] / 3;
+            ushort edgindex = halfEdges[i] % 3;
+            Triangle& triangle = triangles[trindex];
 
-            auto other = edgeMap.find(reverse);
-            if (other == edgeMap.end()) {
-                edgeMap[edge] = { trindex, edgindex };
+            uint a = triangle.ids[edgindex];
+            uint b = triangle.ids[(edgindex + 1) % 3];
+            if (a == b || triangle.neighbors[edgindex] >= 0) {
                 continue;
             }
 
-            // We have found our match, pop and add to adjacency
-            Triangle& otherTriangle = triangles[other->second.first];
-            triangle.adjacency[other->second.first] = edgindex;
-            otherTriangle.adjacency[trindex] = other->second.second;
-            edgeMap.erase(other);
+            for (uint j = i + 1; j < bucketStart[v + 1]; j++) {
+                uint otherIndex = halfEdges[j] / 3;
+                ushort otherEdge = halfEdges[j] % 3;
+                Triangle& otherTriangle = triangles[otherIndex];
+
+                if (otherIndex == trindex || otherTriangle.neighbors[otherEdge] >= 0) {
+                    continue;
+                }
+
+                if (std::max(a, b) != std::max(otherTriangle.ids[otherEdge], otherTriangle.ids[(otherEdge + 1) % 3])) {
+                    continue;
+                }
+
+                // We have found our match, add to adjacency
+                triangle.neighbors[edgindex] = otherIndex;
+                otherTriangle.neighbors[otherEdge] = trindex;
+                break;
+            }
         }
     }
 }
 
-float Navmesh::heuristic(const vec2& cur, const vec2& dest) {
+float Navmesh::heuristic(const vec2& cur, const vec2& dest) const {
     return glm::length2(cur - dest);
 }
 
-float Navmesh::heuristic(int cur, int dest) {
+float Navmesh::heuristic(int cur, int dest) const {
     return heuristic(triangles[cur].center, triangles[dest].center);
 }
 
-int Navmesh::posToTriangle(const vec2& pos) {
-    // Try with tighter epsilon first (point is inside triangle)
-    for (int i = 0; i < triangles.size(); i++) {
-        float dist = triangles[i].distance(pos);
-        if (dist < 1e-6f) {
-            return i;
+/**
+ * @brief Buckets every triangle into the uniform grid cells its bounding box overlaps. 
+ * Earcut must be run before calling this function.
+ */
+void Navmesh::buildGrid() {
+    gridStart.clear();
+    gridTriangles.clear();
+    gridWidth = 0;
+    gridHeight = 0;
+
+    if (triangles.empty()) {
+        return;
+    }
+
+    // Bounds of the whole triangulation
+    vec2 lo(std::numeric_limits<float>::max());
+    vec2 hi(-std::numeric_limits<float>::max());
+    for (const Triangle& tri : triangles) {
+        for (const Vert& v : tri.verts) {
+            lo = glm::min(lo, v.pos);
+            hi = glm::max(hi, v.pos);
         }
     }
-    
-    // Find closest triangle for tolerance fallback
-    if (!triangles.empty()) {
-        int closestIdx = 0;
-        float closestDist = triangles[0].distance(pos);
-        for (int i = 1; i < triangles.size(); i++) {
-            float dist = triangles[i].distance(pos);
-            if (dist < closestDist) {
-                closestDist = dist;
-                closestIdx = i;
+
+    // Aim for roughly one triangle per cell
+    const uint maxCells = 256;
+    vec2 size = glm::max(hi - lo, vec2(EPSILON));
+    float cellSize = std::sqrt(size.x * size.y / triangles.size());
+    gridWidth  = std::clamp((uint) std::ceil(size.x / cellSize), 1u, maxCells);
+    gridHeight = std::clamp((uint) std::ceil(size.y / cellSize), 1u, maxCells);
+    gridMin = lo;
+    gridCellSize = size / vec2(gridWidth, gridHeight);
+
+    // Count triangles per cell, then prefix sum into cell start offsets
+    gridStart.assign(gridWidth * gridHeight + 1, 0);
+    uint x0, y0, x1, y1;
+    for (const Triangle& tri : triangles) {
+        vec2 triLo = glm::min(glm::min(tri.verts[0].pos, tri.verts[1].pos), tri.verts[2].pos);
+        vec2 triHi = glm::max(glm::max(tri.verts[0].pos, tri.verts[1].pos), tri.verts[2].pos);
+        gridRange(triLo, triHi, x0, y0, x1, y1);
+        for (uint y = y0; y <= y1; y++) {
+            for (uint x = x0; x <= x1; x++) {
+                gridStart[y * gridWidth + x + 1]++;
             }
         }
-        
-        // If very close, use it anyway (tolerance for floating point errors)
-        if (closestDist < 0.01f) {
-            return closestIdx;
+    }
+
+    for (uint c = 0; c < gridWidth * gridHeight; c++) {
+        gridStart[c + 1] += gridStart[c];
+    }
+
+    // Fill buckets
+    gridTriangles.resize(gridStart.back());
+    std::vector<uint> cursor(gridStart.begin(), gridStart.end() - 1);
+    for (uint i = 0; i < triangles.size(); i++) {
+        const Triangle& tri = triangles[i];
+        vec2 triLo = glm::min(glm::min(tri.verts[0].pos, tri.verts[1].pos), tri.verts[2].pos);
+        vec2 triHi = glm::max(glm::max(tri.verts[0].pos, tri.verts[1].pos), tri.verts[2].pos);
+        gridRange(triLo, triHi, x0, y0, x1, y1);
+        for (uint y = y0; y <= y1; y++) {
+            for (uint x = x0; x <= x1; x++) {
+                gridTriangles[cursor[y * gridWidth + x]++] = i;
+            }
         }
     }
-    
-    return -1;
 }
 
-void Navmesh::resetAlgoStructs() {
-    open.clear();
-    openLookup.clear();
-    closed.clear();
-    cameFrom.clear();
+/**
+ * @brief Computes the inclusive range of grid cells overlapped by the box [lo, hi]
+ * @return false if the box lies entirely outside of the grid
+ */
+bool Navmesh::gridRange(const vec2& lo, const vec2& hi, uint& x0, uint& y0, uint& x1, uint& y1) const {
+    if (gridWidth == 0 || gridHeight == 0) {
+        return false;
+    }
+
+    vec2 cellLo = glm::floor((lo - gridMin) / gridCellSize);
+    vec2 cellHi = glm::floor((hi - gridMin) / gridCellSize);
+
+    if (cellHi.x < 0 || cellHi.y < 0 || cellLo.x >= gridWidth || cellLo.y >= gridHeight) {
+        return false;
+    }
+
+    x0 = (uint) std::max(cellLo.x, 0.0f);
+    y0 = (uint) std::max(cellLo.y, 0.0f);
+    x1 = (uint) std::min(cellHi.x, (float) gridWidth - 1);
+    y1 = (uint) std::min(cellHi.y, (float) gridHeight - 1);
+    return true;
+}
+
+int Navmesh::posToTriangle(const vec2& pos) const {
+    // Only triangles bucketed within the fallback tolerance of pos can be returned
+    const float tolerance = 0.01f;
+    uint x0, y0, x1, y1;
+    if (!gridRange(pos - vec2(tolerance), pos + vec2(tolerance), x0, y0, x1, y1)) {
+        return -1;
+    }
+
+    int closestIdx = -1;
+    float closestDist = tolerance;
+    for (uint y = y0; y <= y1; y++) {
+        for (uint x = x0; x <= x1; x++) {
+            uint cell = y * gridWidth + x;
+            for (uint k = gridStart[cell]; k < gridStart[cell + 1]; k++) {
+                uint i = gridTriangles[k];
+                float dist = triangles[i].distance(pos);
+
+                // Point is inside triangle
+                if (dist < 1e-6f) {
+                    return i;
+                }
+
+                // Track closest triangle for tolerance fallback (floating point errors)
+                if (dist < closestDist) {
+                    closestDist = dist;
+                    closestIdx = i;
+                }
+            }
+        }
+    }
     
-    // Reset all triangle pathfinding data
-    for (auto& tri : triangles) {
-        tri.reset();
+    return closestIdx;
+}
+
+/**
+ * @brief Starts a new search generation in ctx, invalidating all of its search nodes in O(1)
+ */
+void Navmesh::resetAlgoStructs(SearchContext& ctx) const {
+    ctx.open.clear();
+    ctx.expansions = 0;
+
+    // Search state only needs to grow when the triangulation changes
+    if (ctx.nodes.size() != triangles.size()) {
+        ctx.nodes.assign(triangles.size(), SearchNode());
+        ctx.searchGeneration = 0;
+    }
+
+    // Stamps from before a wrap around could alias the new generation
+    ctx.searchGeneration++;
+    if (ctx.searchGeneration == 0) {
+        std::fill(ctx.nodes.begin(), ctx.nodes.end(), SearchNode());
+        ctx.searchGeneration = 1;
     }
 }
 
+void Navmesh::pushOpen(std::vector<PQPair>& open, uint index, float f) {
+    open.emplace_back(index, f);
+    std::push_heap(open.begin(), open.end(), PQCompare());
+}
+
+void Navmesh::resetMesh() {
+    mesh.clear();
+    rings.clear();
+}
+
 void Navmesh::clear() {
-    resetAlgoStructs();
+    clearFlowField();
+    search.context = SearchContext();
     mesh.clear();
     rings.clear();
     triangles.clear();
+    buildGrid();
+    version = nextVersion++;
 }
 
 void Navmesh::getPath(std::vector<vec2>& path, vec2 start, vec2 dest, float padding) {
+    getPath(path, start, dest, padding, search.context);
+}
+
+/**
+ * @brief Finds a path using the caller's scratch, the navmesh itself is only read so any number of 
+ * threads may search it at once as long as each brings its own context.
+ */
+void Navmesh::getPath(std::vector<vec2>& path, vec2 start, vec2 dest, float padding, SearchContext& ctx) const {
     path.clear();
     
     // Reset all algorithm structures to ensure clean state
-    resetAlgoStructs();
-    
-    // Run A* to get triangle path
-    std::vector<uint> trianglePath;
-    AStar(start, dest, trianglePath);
+    resetAlgoStructs(ctx);
+
+    // Convert positions to triangles
+    int startTri = posToTriangle(start);
+    int destTri = posToTriangle(dest);
+    if (startTri < 0 || destTri < 0) {
+        ctx.trianglePath.clear();
+        return;
+    }
+
+    // Corridors only depend on the triangles and the triangulation, reuse one found earlier when possible.
+    // The ring is allocated once per context, afterwards neither hits nor misses allocate
+    if (ctx.cacheKeys.empty()) {
+        ctx.cacheKeys.assign(PATH_CACHE_SLOTS, PATH_CACHE_EMPTY);
+        ctx.cacheLengths.assign(PATH_CACHE_SLOTS, 0);
+        ctx.cacheTriangles.resize(PATH_CACHE_SLOTS * PATH_CACHE_SLOT_LENGTH);
+        ctx.cacheVersion = version;
+    }
+    if (ctx.cacheVersion != version) {
+        std::fill(ctx.cacheKeys.begin(), ctx.cacheKeys.end(), PATH_CACHE_EMPTY);
+        ctx.cacheNext = 0;
+        ctx.cacheVersion = version;
+    }
+
+    uint64_t key = pathCacheKey(startTri, destTri);
+    auto cached = std::find(ctx.cacheKeys.begin(), ctx.cacheKeys.end(), key);
+    if (cached != ctx.cacheKeys.end()) {
+        ctx.cacheHits++;
+        size_t slot = cached - ctx.cacheKeys.begin();
+        auto begin = ctx.cacheTriangles.begin() + slot * PATH_CACHE_SLOT_LENGTH;
+        ctx.trianglePath.assign(begin, begin + ctx.cacheLengths[slot]);
+    } else {
+        ctx.cacheMisses++;
+
+        // Run A* to get triangle path
+        AStar(ctx, startTri, destTri);
+
+        if (ctx.trianglePath.size() <= PATH_CACHE_SLOT_LENGTH) {
+            uint slot = ctx.cacheNext;
+            ctx.cacheNext = (ctx.cacheNext + 1) % PATH_CACHE_SLOTS;
+            ctx.cacheKeys[slot] = key;
+            ctx.cacheLengths[slot] = ctx.trianglePath.size();
+            std::copy(ctx.trianglePath.begin(), ctx.trianglePath.end(), ctx.cacheTriangles.begin() + slot * PATH_CACHE_SLOT_LENGTH);
+        }
+    }
     
-    if (trianglePath.empty()) {
+    if (ctx.trianglePath.empty()) {
         return; // No path found
     }
     
     // Get portals from triangle path with padding
-    getPortals(trianglePath, padding);
-    
-    // Build path using portal centers as waypoints
-    path.clear();
-    path.push_back(start);
+    getPortals(ctx, padding);
     
-    // Add center of each portal as a waypoint
-    for (const Edge& portal : portals) {
-        vec2 portalCenter = (portal.first + portal.second) * 0.5f;
-        path.push_back(portalCenter);
-    }
-    
-    // Always add destination
-    if (path.empty() || glm::length2(path.back() - dest) > 1e-6f) {
-        path.push_back(dest);
-    }
+    // Pull the path taut through the portals, leaving only corner waypoints
+    funnel(ctx, path, start, dest);
 }
 
-void Navmesh::AStar(const vec2& startPos, const vec2& destPos, std::vector<uint>& path) {
-    // Convert positions to triangles
-    int start = posToTriangle(startPos);
-    int dest = posToTriangle(destPos);
-    path.clear();
+/**
+ * @brief Packs a cache key from the start and goal triangles, both non negative so the key is never PATH_CACHE_EMPTY
+ */
+uint64_t Navmesh::pathCacheKey(int start, int dest) {
+    return ((uint64_t)(uint)start << 32) | (uint)dest;
+}
 
-    // Check if we found valid pathing locations
-    if (start < 0 || dest < 0) {
-        return;
-    }
+void Navmesh::AStar(SearchContext& ctx, int start, int dest) const {
+    std::vector<uint>& path = ctx.trianglePath;
+    std::vector<SearchNode>& nodes = ctx.nodes;
+    std::vector<PQPair>& open = ctx.open;
+    uint searchGeneration = ctx.searchGeneration;
+    path.clear();
 
     // Same triangle optimization
     if (start == dest) {
@@ -207,26 +430,28 @@ void Navmesh::AStar(const vec2& startPos, const vec2& destPos, std::vector<uint>
     }
 
     // Prep values for initial triangle
-    Triangle& startTri = triangles[start];
-    startTri.g = 0;
-    startTri.f = heuristic(start, dest);
-
-    // Add to data structures
-    open.emplace(start, startTri.f);
-    openLookup.insert(start);
+    SearchNode& startNode = nodes[start];
+    startNode.g = 0;
+    startNode.parent = start;
+    startNode.visited = searchGeneration;
+    pushOpen(open, start, heuristic(start, dest));
 
     while (!open.empty()) {
-        uint curIdx = open.top().index;
-        open.pop();
-
-        Triangle& cur = triangles[curIdx];
-        openLookup.erase(curIdx);
+        std::pop_heap(open.begin(), open.end(), PQCompare());
+        uint curIdx = open.back().index;
+        open.pop_back();
+
+        // Skip stale entries left behind when a triangle was pushed again with a better score
+        SearchNode& cur = nodes[curIdx];
+        if (cur.closed == searchGeneration) {
+            continue;
+        }
 
         // Check if we have found the goal, reconstruct path
         if (curIdx == dest) {
             path.push_back(curIdx);
-            while (cameFrom.find(curIdx) != cameFrom.end()) {
-                curIdx = cameFrom[curIdx];
+            while (curIdx != start) {
+                curIdx = nodes[curIdx].parent;
                 path.push_back(curIdx);
             }
             std::reverse(path.begin(), path.end());
@@ -234,29 +459,29 @@ void Navmesh::AStar(const vec2& startPos, const vec2& destPos, std::vector<uint>
         }
 
         // Mark current as visited
-        closed.insert(curIdx);
+        cur.closed = searchGeneration;
+        ctx.expansions++;
 
         // Integrate adjacents
-        for (const auto& [adjIdx, edgeIdx] : cur.adjacency) {
-            if (closed.find(adjIdx) != closed.end()) {
+        for (int adjIdx : triangles[curIdx].neighbors) {
+            if (adjIdx < 0) {
+                continue;
+            }
+
+            SearchNode& adj = nodes[adjIdx];
+            if (adj.closed == searchGeneration) {
                 continue;
             }
 
             // Compute new neighbor cost
-            Triangle& adj = triangles[adjIdx];
-            float gTent = cur.g + glm::length(cur.center - adj.center);
+            float gTent = cur.g + glm::length(triangles[curIdx].center - triangles[adjIdx].center);
 
-            // If neighbor not in open set or find a better path
-            bool notInLookup = openLookup.find(adjIdx) == openLookup.end();
-            if (gTent < adj.g) {
-                cameFrom[adjIdx] = curIdx;
+            // If neighbor not seen this search or we find a better path
+            if (adj.visited != searchGeneration || gTent < adj.g) {
+                adj.visited = searchGeneration;
+                adj.parent = curIdx;
                 adj.g = gTent;
-                adj.f = gTent + heuristic(adjIdx, dest);
-
-                if (notInLookup) {
-                    open.emplace(adjIdx, adj.f);
-                    openLookup.insert(adjIdx);
-                }
+                pushOpen(open, adjIdx, gTent + heuristic(adjIdx, dest));
             }
         }
     }
@@ -266,67 +491,464 @@ void Navmesh::AStar(const vec2& startPos, const vec2& destPos, std::vector<uint>
 }
 
 /**
- * @brief Selects the edges of triangles connecting triangles along the A* path
- * @param path the indices of all triangles taken by A*
+ * @brief Selects the edges of triangles connecting triangles along the A* path (ctx.trianglePath)
+ * @param padding the agent radius to keep away from portal endpoints
  */
-void Navmesh::getPortals(const std::vector<uint>& path, float padding) {
-    portals.clear();
-
-    for (uint i = 0; i < path.size() - 1; i++) {
-        const Triangle& triangle = triangles[path[i]];
-        const Triangle& nextTriangle = triangles[path[i + 1]];
-        
-        auto it = triangle.adjacency.find(path[i + 1]);
-        if (it != triangle.adjacency.end()) {
-            ushort edgeIndex = it->second;
-            Edge edge = triangle[edgeIndex];
-            
-            vec2 portalLeft = edge.first;
-            vec2 portalRight = edge.second;
-            
-            // Apply padding to push portal outward if padding > 0
-            if (padding > 0.0f) {
-                // Calculate portal edge direction
-                vec2 edgeDir = portalRight - portalLeft;
-                float edgeLen = glm::length(edgeDir);
-                
-                if (edgeLen > 1e-6f) {
-                    // Calculate edge normal (perpendicular, pointing from first triangle toward next)
-                    vec2 edgeNormal = vec2(-edgeDir.y, edgeDir.x) / edgeLen;  // Rotate 90 degrees counterclockwise
-                    
-                    // Determine which direction is "outward" - normal should point from triangle center toward next triangle center
-                    vec2 toNextCenter = glm::normalize(nextTriangle.center - triangle.center);
-                    float dot = glm::dot(edgeNormal, toNextCenter);
-                    
-                    // If normal points away from next triangle, flip it
-                    if (dot < 0.0f) {
-                        edgeNormal = -edgeNormal;
-                    }
-                    
-                    // Push both endpoints outward along the normal
-                    portalLeft += edgeNormal * padding;
-                    portalRight += edgeNormal * padding;
-                }
+void Navmesh::getPortals(SearchContext& ctx, float padding) const {
+    const std::vector<uint>& path = ctx.trianglePath;
+    ctx.portals.clear();
+
+    Edge edge;
+    for (uint i = 0; i + 1 < path.size(); i++) {
+        if (getPortal(path[i], path[i + 1], edge, padding)) {
+            ctx.portals.push_back(edge);
+        }
+    }
+}
+
+/**
+ * @brief Finds the edge shared by two adjacent triangles, stored as (left, right) relative to the direction 
+ * of travel and shrunk by padding from both ends so that agents keep clear of corners.
+ * @return false if the triangles are not adjacent
+ */
+bool Navmesh::getPortal(uint from, uint to, Edge& portal, float padding) const {
+    const Triangle& triangle = triangles[from];
+
+    auto it = std::find(triangle.neighbors.begin(), triangle.neighbors.end(), (int) to);
+    if (it == triangle.neighbors.end()) {
+        return false;
+    }
+
+    Edge edge = triangle[it - triangle.neighbors.begin()];
+
+    // Leaving the triangle through the edge, the endpoint clockwise from the center is on the right
+    vec2 portalLeft = edge.second;
+    vec2 portalRight = edge.first;
+    if (cross(edge.first - triangle.center, edge.second - triangle.center) < 0.0f) {
+        std::swap(portalLeft, portalRight);
+    }
+
+    // Shrink portal by padding, collapsing to the midpoint if the agent barely fits
+    if (padding > 0.0f) {
+        vec2 edgeDir = portalLeft - portalRight;
+        float edgeLen = glm::length(edgeDir);
+
+        if (edgeLen > 2.0f * padding) {
+            edgeDir /= edgeLen;
+            portalLeft -= edgeDir * padding;
+            portalRight += edgeDir * padding;
+        } else {
+            portalLeft = portalRight = (portalLeft + portalRight) * 0.5f;
+        }
+    }
+
+    portal = { portalLeft, portalRight };
+    return true;
+}
+
+/**
+ * @brief Simple stupid funnel algorithm, port of scripts/funnel.py. Walks the portals keeping the 
+ * narrowest left/right funnel from the apex and emits a corner whenever one side crosses the other.
+ * @param path output, start followed by the corners and dest
+ */
+void Navmesh::funnel(const SearchContext& ctx, std::vector<vec2>& path, const vec2& start, const vec2& dest) const {
+    const std::vector<Edge>& portals = ctx.portals;
+    path.clear();
+    path.push_back(start);
+
+    // Portal i of the funnel, bracketed by degenerate portals at start and dest
+    uint numPortals = portals.size() + 2;
+    auto portalAt = [&](uint i) -> Edge {
+        if (i == 0) return { start, start };
+        if (i == numPortals - 1) return { dest, dest };
+        return portals[i - 1];
+    };
+
+    auto same = [](const vec2& a, const vec2& b) {
+        return glm::length2(a - b) < 1e-6f;
+    };
+
+    vec2 apex = start;
+    vec2 left = start;
+    vec2 right = start;
+    uint apexIndex = 0;
+    uint leftIndex = 0;
+    uint rightIndex = 0;
+
+    for (uint i = 1; i < numPortals; i++) {
+        auto [newLeft, newRight] = portalAt(i);
+
+        // Tighten right side if the new right is not outside the funnel
+        if (cross(right - apex, newRight - apex) >= 0.0f) {
+            if (same(apex, right) || cross(left - apex, newRight - apex) < 0.0f) {
+                right = newRight;
+                rightIndex = i;
+            } else {
+                // Right crossed over left, left becomes a corner and the new apex
+                path.push_back(left);
+                apex = left;
+                apexIndex = leftIndex;
+                right = apex;
+                rightIndex = apexIndex;
+                i = apexIndex;
+                continue;
             }
-            
-            // Store portal endpoints
-            portals.push_back({portalLeft, portalRight});
         }
+
+        // Tighten left side if the new left is not outside the funnel
+        if (cross(left - apex, newLeft - apex) <= 0.0f) {
+            if (same(apex, left) || cross(right - apex, newLeft - apex) > 0.0f) {
+                left = newLeft;
+                leftIndex = i;
+            } else {
+                // Left crossed over right, right becomes a corner and the new apex
+                path.push_back(right);
+                apex = right;
+                apexIndex = rightIndex;
+                left = apex;
+                leftIndex = apexIndex;
+                i = apexIndex;
+                continue;
+            }
+        }
+    }
+
+    // Always add destination
+    if (!same(path.back(), dest)) {
+        path.push_back(dest);
     }
 }
 
 void Navmesh::generateNavmesh() {
+    // Any flow field refers to the old triangles
+    clearFlowField();
+
     if (mesh.empty()) {
+        // Nothing to walk on, drop the old triangles so no lookup or cached corridor indexes into them
+        triangles.clear();
+        buildGrid();
+        version = nextVersion++;
         return;
     }
-    
-    // Earcut the mesh
+
+    // Earcut the mesh and bucket triangles for point location
     earcut();
+    buildGrid();
     
     if (triangles.empty()) {
+        version = nextVersion++; // corridors cached against the old triangles are stale too
         return;
     }
     
     // Build adjacency graph
-    buildGraph();
+    buildGraph(mesh.size());
+    version = nextVersion++;
+}
+
+/**
+ * @brief Updates the triangulation after the rings changed only inside the dirty boxes. Triangles overlapping 
+ * a dirty box are dropped, the hole they leave (together with the boxes, which may have gained area) is clipped 
+ * against the new rings and re-triangulated, then adjacency is rebuilt across the seam. Falls back to a full 
+ * rebuild when there is nothing to patch or the patch does not cover the hole.
+ * @param dirty (min, max) boxes containing every change made to the rings since the last build
+ */
+void Navmesh::generateNavmesh(const std::vector<std::pair<vec2, vec2>>& dirty) {
+    if (mesh.empty()) {
+        return;
+    }
+
+    if (triangles.empty() || dirty.empty()) {
+        generateNavmesh();
+        return;
+    }
+
+    // Any flow field refers to the old triangles
+    clearFlowField();
+
+    auto overlapsDirty = [&](const vec2& lo, const vec2& hi) {
+        for (const auto& [boxLo, boxHi] : dirty) {
+            if (lo.x <= boxHi.x + EPSILON && hi.x >= boxLo.x - EPSILON && 
+                lo.y <= boxHi.y + EPSILON && hi.y >= boxLo.y - EPSILON) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // Split into untouched triangles and the hole to re-triangulate
+    std::vector<Triangle> kept;
+    kept.reserve(triangles.size());
+    Paths64 hole;
+    for (const auto& [boxLo, boxHi] : dirty) {
+        if (boxLo.x > boxHi.x || boxLo.y > boxHi.y) {
+            continue; // bounds of an empty region
+        }
+        hole.push_back(makePaths64FromRegion({ boxLo, { boxHi.x, boxLo.y }, boxHi, { boxLo.x, boxHi.y } })[0]);
+    }
+
+    for (const Triangle& tri : triangles) {
+        vec2 triLo = glm::min(glm::min(tri.verts[0].pos, tri.verts[1].pos), tri.verts[2].pos);
+        vec2 triHi = glm::max(glm::max(tri.verts[0].pos, tri.verts[1].pos), tri.verts[2].pos);
+        if (overlapsDirty(triLo, triHi)) {
+            hole.push_back(makePaths64FromRegion(tri.toPolygon())[0]);
+        } else {
+            kept.push_back(tri);
+        }
+    }
+
+    // Clip the hole against the new rings, only obstacles reaching into the hole matter. The hole's boundary runs through 
+    // vertices of the kept triangles, collinear ones included, and dropping those would leave T junctions the welded 
+    // adjacency cannot link across, so every boolean here preserves them
+    Clipper64 clipper;
+    clipper.PreserveCollinear(true);
+    auto clipPaths = [&](ClipType clipType, const Paths64& subject, const Paths64& clip) {
+        clipper.Clear();
+        clipper.AddSubject(subject);
+        if (!clip.empty()) clipper.AddClip(clip);
+        Paths64 sol;
+        clipper.Execute(clipType, FillRule::NonZero, sol);
+        return sol;
+    };
+
+    Paths64 patch;
+    try {
+        hole = clipPaths(ClipType::Union, hole, {});
+        Rect64 holeBounds = GetBounds(hole);
+
+        Paths64 outer;
+        Paths64 obstacles;
+        uint startIdx = 0;
+        for (uint r = 0; r < rings.size(); r++) {
+            std::vector<vec2> ring(mesh.begin() + startIdx, mesh.begin() + rings[r]);
+            startIdx = rings[r];
+            if (ring.size() < 3) {
+                continue;
+            }
+
+            Path64 path = makePaths64FromRegion(ring)[0];
+            if (r == 0) {
+                outer.push_back(std::move(path));
+                continue;
+            }
+
+            Rect64 bounds = GetBounds(path);
+            if (bounds.left <= holeBounds.right && bounds.right >= holeBounds.left && 
+                bounds.top <= holeBounds.bottom && bounds.bottom >= holeBounds.top) {
+                obstacles.push_back(std::move(path));
+            }
+        }
+
+        patch = clipPaths(ClipType::Intersection, outer, hole);
+        if (!obstacles.empty()) {
+            patch = clipPaths(ClipType::Difference, patch, obstacles);
+        }
+    } catch (...) {
+        std::cout << "[Navmesh::generateNavmesh] clipping failed, rebuilding from scratch" << std::endl;
+        generateNavmesh();
+        return;
+    }
+
+    // Group patch paths into outer rings and the holes they contain
+    auto toRing = [](const Path64& path) {
+        std::vector<vec2> ring;
+        ring.reserve(path.size());
+        for (const Point64& pt : path) {
+            ring.emplace_back(static_cast<float>(pt.x / CLIPPER_SCALE), static_cast<float>(pt.y / CLIPPER_SCALE));
+        }
+        return ring;
+    };
+
+    auto inside = [](const vec2& p, const std::vector<vec2>& ring) {
+        bool in = false;
+        for (size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++) {
+            if ((ring[i].y > p.y) != (ring[j].y > p.y) && 
+                p.x < (ring[j].x - ring[i].x) * (p.y - ring[i].y) / (ring[j].y - ring[i].y) + ring[i].x) {
+                in = !in;
+            }
+        }
+        return in;
+    };
+
+    std::vector<std::vector<std::vector<vec2>>> polygons;
+    std::vector<double> polygonAreas;
+    std::vector<std::vector<vec2>> holes;
+    double patchArea = 0.0;
+    for (const Path64& path : patch) {
+        double area = Area(path);
+        patchArea += area;
+        if (area > 0.0) {
+            polygons.push_back({ toRing(path) });
+            polygonAreas.push_back(area);
+        } else {
+            holes.push_back(toRing(path));
+        }
+    }
+
+    for (std::vector<vec2>& ring : holes) {
+        int best = -1;
+        for (uint i = 0; i < polygons.size(); i++) {
+            if ((best < 0 || polygonAreas[i] < polygonAreas[best]) && inside(ring[0], polygons[i][0])) {
+                best = i;
+            }
+        }
+        if (best >= 0) {
+            polygons[best].push_back(std::move(ring));
+        }
+    }
+
+    // Triangulate the patch
+    ScratchScope scratch;
+    double patchTriangleArea = 0.0;
+    std::vector<uint> indices;
+    std::pmr::vector<vec2> flat(scratch.resource());
+    for (const auto& polygon : polygons) {
+        earcut(polygon, indices);
+
+        flat.clear();
+        for (const auto& ring : polygon) {
+            flat.insert(flat.end(), ring.begin(), ring.end());
+        }
+
+        for (uint i = 0; i + 2 < indices.size(); i += 3) {
+            vec2 a = flat[indices[i]];
+            vec2 b = flat[indices[i + 1]];
+            vec2 c = flat[indices[i + 2]];
+            patchTriangleArea += 0.5 * std::abs(cross(b - a, c - a));
+            kept.emplace_back(a, b, c);
+        }
+    }
+
+    // The triangles have to cover the patch, otherwise earcut gave up on part of it
+    patchArea /= CLIPPER_SCALE * CLIPPER_SCALE;
+    if (std::abs(patchTriangleArea - patchArea) > 1e-3 * std::max(patchArea, 1.0)) {
+        std::cout << "[Navmesh::generateNavmesh] patch triangulation incomplete, rebuilding from scratch" << std::endl;
+        generateNavmesh();
+        return;
+    }
+
+    triangles = std::move(kept);
+
+    // Weld corners of old and new triangles together so the seam is stitched by index
+    std::vector<vec2> corners;
+    corners.reserve(3 * triangles.size());
+    for (const Triangle& tri : triangles) {
+        for (const Vert& v : tri.verts) {
+            corners.push_back(v.pos);
+        }
+    }
+
+    std::vector<uint> weld;
+    weldVertices(corners, weld);
+    for (uint i = 0; i < triangles.size(); i++) {
+        triangles[i].ids = { weld[3 * i + 0], weld[3 * i + 1], weld[3 * i + 2] };
+    }
+
+    buildGrid();
+    buildGraph(corners.size());
+    version = nextVersion++;
+}
+
+/**
+ * @brief Runs a single Dijkstra outward from the goal's triangle and stores, for every triangle, 
+ * the neighbor to step into to get closer to the goal. Lets any number of agents chasing the same 
+ * goal share one search.
+ */
+void Navmesh::buildFlowField(const vec2& goal) {
+    flowGoal = posToTriangle(goal);
+    flowNext.assign(triangles.size(), -1);
+    flowCost.assign(triangles.size(), std::numeric_limits<float>::infinity());
+
+    if (flowGoal < 0) {
+        return;
+    }
+
+    // Open set reuses the A* heap
+    std::vector<PQPair>& open = search.context.open;
+    open.clear();
+    flowNext[flowGoal] = flowGoal;
+    flowCost[flowGoal] = 0.0f;
+    pushOpen(open, flowGoal, 0.0f);
+
+    while (!open.empty()) {
+        std::pop_heap(open.begin(), open.end(), PQCompare());
+        PQPair cur = open.back();
+        open.pop_back();
+
+        // Skip stale entries
+        if (cur.f > flowCost[cur.index]) {
+            continue;
+        }
+
+        for (int adjIdx : triangles[cur.index].neighbors) {
+            if (adjIdx < 0) {
+                continue;
+            }
+
+            float cost = cur.f + glm::length(triangles[cur.index].center - triangles[adjIdx].center);
+            if (cost < flowCost[adjIdx]) {
+                flowCost[adjIdx] = cost;
+                flowNext[adjIdx] = cur.index;
+                pushOpen(open, adjIdx, cost);
+            }
+        }
+    }
+}
+
+void Navmesh::clearFlowField() {
+    flowGoal = -1;
+    flowNext.clear();
+    flowCost.clear();
+}
+
+/**
+ * @brief Reads the flow field at pos and gives the point to steer toward. Looks one portal ahead: 
+ * if the straight line to the following portal fits through the next portal, steer at it directly, 
+ * otherwise steer at the (padded) end of the next portal it would clip.
+ * @param dest the actual goal, used once pos reaches the flow field's goal triangle
+ * @return false if there is no flow field or pos cannot reach the goal
+ */
+bool Navmesh::getFlowWaypoint(const vec2& pos, const vec2& dest, vec2& waypoint, float padding) const {
+    if (flowGoal < 0) {
+        return false;
+    }
+
+    int cur = posToTriangle(pos);
+    if (cur < 0 || flowNext[cur] < 0) {
+        return false;
+    }
+
+    if (cur == flowGoal) {
+        waypoint = dest;
+        return true;
+    }
+
+    Edge portal;
+    int next = flowNext[cur];
+    if (!getPortal(cur, next, portal, padding)) {
+        return false;
+    }
+
+    // Point the field heads toward after crossing this portal
+    vec2 ahead = dest;
+    Edge nextPortal;
+    if (next != flowGoal && getPortal(next, flowNext[next], nextPortal)) {
+        ahead = (nextPortal.first + nextPortal.second) * 0.5f;
+    }
+
+    // Intersect pos -> ahead with the portal, parameterized from right (0) to left (1)
+    vec2 portalDir = portal.first - portal.second;
+    vec2 toAhead = ahead - pos;
+    float denom = cross(toAhead, portalDir);
+    if (std::abs(denom) < 1e-8f) {
+        waypoint = (portal.first + portal.second) * 0.5f;
+        return true;
+    }
+
+    float t = cross(portal.second - pos, toAhead) / denom;
+    if (t > 0.0f && t < 1.0f) {
+        waypoint = ahead;
+    } else {
+        waypoint = t <= 0.0f ? portal.second : portal.first;
+    }
+    return true;
 }
\ No newline at end of file
@@ -4,48 +4,20 @@
 #include "util/includes.h"
 #include "util/maths.h"
 #include "levels/triangle.h"
+#include <atomic>
 
 class Navmesh {
 private:
     using Edge = std::pair<vec2, vec2>;
 
-    struct Vec2Hash {
-        std::size_t operator()(const vec2& v) const noexcept {
-            return std::hash<float>()(v.x) ^ (std::hash<float>()(v.y) << 1);
-        }
-    };
-
-    // Custom hash function for Edge
-    struct EdgeHash {
-        std::size_t operator()(const Edge& e) const noexcept {
-            std::size_t h1 = Vec2Hash{}(e.first);
-            std::size_t h2 = Vec2Hash{}(e.second);
-            return h1 ^ (h2 + 0x9e3779b9 + (h1 << 6) + (h1 >> 2));
-        }
-    };
-
-    // Custom equality with epsilon tolerance for floating point comparison
-    struct EdgeEqual {
-        bool operator()(const Edge& a, const Edge& b) const noexcept {
-            // Check if endpoints match (in either order) with tolerance
-            bool match1 = glm::length2(a.first - b.first) < EPSILON * EPSILON &&
-                         glm::length2(a.second - b.second) < EPSILON * EPSILON;
-            bool match2 = glm::length2(a.first - b.second) < EPSILON * EPSILON &&
-                         glm::length2(a.second - b.first) < EPSILON * EPSILON;
-            return match1 || match2;
-        }
-    };
-
     struct Triangle : public Tri {
         vec2 center;
-        std::unordered_map<uint, ushort> adjacency;
-        float g;
-        float f;
+        std::array<uint, 3> ids; // welded mesh vertex indices
+        std::array<int, 3> neighbors; // triangle across edge i, -1 on the boundary
 
         Triangle(vec2& a, vec2& b, vec2& c);
         ~Triangle() = default;
 
-        void reset();
         Edge operator[](size_t index) const;
     };
 
@@ -54,6 +26,14 @@ private:
     std::vector<uint> rings; // contains the end index of all ring segments
     std::vector<Triangle> triangles;
 
+    // uniform grid of triangle buckets used for point location, cell c spans gridTriangles[gridStart[c], gridStart[c + 1])
+    vec2 gridMin;
+    vec2 gridCellSize;
+    uint gridWidth = 0;
+    uint gridHeight = 0;
+    std::vector<uint> gridStart;
+    std::vector<uint> gridTriangles;
+
     // custom struct to hold pq triangle relationships
     struct PQPair {
         uint index;
@@ -69,20 +49,63 @@ private:
         }
     };
 
-    // custom priority queue that support clearing
-    class OpenQueue : public std::priority_queue<PQPair, std::vector<PQPair>, PQCompare> {
-    public:
-        void clear() { this->c.clear(); }
+    // per triangle search state, entries are only valid when their stamp matches searchGeneration
+    struct SearchNode {
+        float g = 0.0f;
+        uint parent = 0;
+        uint visited = 0;
+        uint closed = 0;
     };
 
-    // a* variables
-    OpenQueue open; 
-    std::set<uint> openLookup;
-    std::set<uint> closed;
-    std::unordered_map<uint, uint> cameFrom;
+    // triangle corridors already solved, keyed by pathCacheKey. Only the portals and funnel are redone on a hit,
+    // so padding is not part of the key. Corridors longer than a slot are not cached
+    static constexpr size_t PATH_CACHE_SLOTS = 256;
+    static constexpr size_t PATH_CACHE_SLOT_LENGTH = 128;
+    static constexpr uint64_t PATH_CACHE_EMPTY = ~0ull;
 
-    // portal variables (used for pathfinding)
-    std::vector<Edge> portals;
+public:
+    // a* variables, reused between queries so a search does not allocate. Each thread searching a shared navmesh needs its own
+    struct SearchContext {
+        std::vector<SearchNode> nodes;
+        std::vector<PQPair> open; // binary heap ordered by PQCompare
+        std::vector<uint> trianglePath;
+        std::vector<Edge> portals;
+        uint searchGeneration = 0;
+        uint expansions = 0; // triangles closed by the last search
+
+        // corridors found on navmesh cacheVersion, dropped as soon as a search runs on any other version.
+        // Slot s holds cacheLengths[s] triangles at cacheTriangles[s * PATH_CACHE_SLOT_LENGTH], new corridors overwrite the oldest slot
+        std::vector<uint64_t> cacheKeys;
+        std::vector<uint> cacheLengths;
+        std::vector<uint> cacheTriangles;
+        uint cacheNext = 0;
+        uint cacheVersion = 0;
+        uint64_t cacheHits = 0;
+        uint64_t cacheMisses = 0;
+    };
+
+private:
+    // scratch for the single threaded calls. Copies of a navmesh (the workers' snapshots among them) start 
+    // with an empty one instead of copying the buffers and the corridor cache
+    struct OwnSearch {
+        SearchContext context;
+
+        OwnSearch() = default;
+        OwnSearch(const OwnSearch&) {}
+        OwnSearch(OwnSearch&&) noexcept = default;
+        OwnSearch& operator=(const OwnSearch&) { context = SearchContext(); return *this; }
+        OwnSearch& operator=(OwnSearch&&) noexcept = default;
+    };
+    OwnSearch search;
+
+    // unique across all navmeshes, changes whenever the triangulation does
+    static std::atomic<uint> nextVersion;
+    uint version = 0;
+
+    // flow field toward a shared goal, flowNext[i] is the triangle to step into from i (-1 if unreachable)
+    std::vector<int> flowNext;
+    std::vector<float> flowCost;
+    int flowGoal = -1;
 
 public:
     Navmesh(const std::vector<vec2>& paperMesh);
@@ -96,24 +119,46 @@ public:
     void addObstacle(std::vector<vec2> obstacleMesh);
     void addMesh(std::vector<vec2> mesh);
     void getPath(std::vector<vec2>& path, vec2 start, vec2 dest, float padding = 0.0f);
+    void getPath(std::vector<vec2>& path, vec2 start, vec2 dest, float padding, SearchContext& ctx) const;
     void generateNavmesh();
+    void generateNavmesh(const std::vector<std::pair<vec2, vec2>>& dirty);
+
+    void buildFlowField(const vec2& goal);
+    void clearFlowField();
+    bool getFlowWaypoint(const vec2& pos, const vec2& dest, vec2& waypoint, float padding = 0.0f) const;
 
     static void earcut(const std::vector<std::vector<vec2>>& polygon, std::vector<uint>& indices);
     static void convertToMesh(const std::vector<std::vector<vec2>>& polygon, std::vector<uint>& indices, std::vector<float>& data);
 
+    uint getVersion() const { return version; }
+    uint getTriangleCount() const { return triangles.size(); }
+    uint getLastExpansions() const { return search.context.expansions; }
+    uint64_t getCacheHits() const { return search.context.cacheHits; }
+    uint64_t getCacheMisses() const { return search.context.cacheMisses; }
+    int locate(const vec2& pos) const { return posToTriangle(pos); }
+    int getFlowGoal() const { return flowGoal; }
+
     void clear();
+    void resetMesh(); // drops the rings but keeps the triangulation for incremental updates
 
 private:
     void earcut();
-    void buildGraph();
-
-    float heuristic(int cur, int dest);
-    float heuristic(const vec2& cur, const vec2& dest);
-
-    int posToTriangle(const vec2& pos);
-    void resetAlgoStructs();
-    void AStar(const vec2& start, const vec2& dest, std::vector<uint>& path);
-    void getPortals(const std::vector<uint>& path, float padding = 0.0f);
+    static void weldVertices(const std::vector<vec2>& verts, std::vector<uint>& weld);
+    void buildGraph(uint vertexCount);
+    void buildGrid();
+    bool gridRange(const vec2& lo, const vec2& hi, uint& x0, uint& y0, uint& x1, uint& y1) const;
+
+    float heuristic(int cur, int dest) const;
+    float heuristic(const vec2& cur, const vec2& dest) const;
+
+    int posToTriangle(const vec2& pos) const;
+    void resetAlgoStructs(SearchContext& ctx) const;
+    static void pushOpen(std::vector<PQPair>& open, uint index, float f);
+    static uint64_t pathCacheKey(int start, int dest);
+    void AStar(SearchContext& ctx, int start, int dest) const;
+    void getPortals(SearchContext& ctx, float padding = 0.0f) const;
+    bool getPortal(uint from, uint to, Edge& portal, float padding = 0.0f) const;
+    void funnel(const SearchContext& ctx, std::vector<vec2>& path, const vec2& start, const vec2& dest) const;
 
     inline float sign(const vec2& a, const vec2& b, const vec2& c) {
         vec2 ab = b - a;
@@ -1,12 +1,15 @@
 #include "levels/navmesh.h"
 #include <earcut.hpp>
+#include "util/scratch.h"
 
 // get triangle indices from earcut
 void Navmesh::earcut(const std::vector<std::vector<vec2>>& polygon, std::vector<uint>& indices) {
-    std::vector<std::vector<std::array<double, 2>>> polyDouble;
+    ScratchScope scratch;
+    std::pmr::vector<std::pmr::vector<std::array<double, 2>>> polyDouble(scratch.resource());
     polyDouble.resize(polygon.size());
 
     for (uint i = 0; i < polygon.size(); i++) {
+        polyDouble[i].reserve(polygon[i].size());
         for (uint j = 0; j < polygon.at(i).size(); j++) {
             vec2 v = polygon[i][j];
             polyDouble[i].push_back({v.x, v.y});
@@ -2,6 +2,8 @@
 #include "util/maths.h"
 #include "audio/sfx_player.h"
 #include "util/clipper_helper.h"
+#include "levels/pathWorkers.h"
+#include "util/scratch.h"
 
 Paper::Paper() : 
     curSide(0), 
@@ -205,7 +207,7 @@ bool Paper::activateFold(const vec2& start) {
     for (int i = static_cast<int>(folds.size()) - 1; i >= 0; i--) {
         if (folds[i].side != curSide) continue;
 
-        if (folds[i].cover->contains(start)) {
+        if (folds[i].coverContains(start)) {
             activeFold = i;
             return true;
         }
@@ -301,6 +303,9 @@ Paper::FoldGeometry Paper::validateFoldGeometry(const vec2& start, const vec2& e
 
 bool Paper::fold(const vec2& start, const vec2& end) {
     if (activeFold == NULL_FOLD || glm::length2(start - end) < EPSILON) return false;
+
+    // geometry temporaries of the whole fold share one scratch operation
+    ScratchScope scratch;
     
     // Validate fold geometry and check if start/end are inside paper
     FoldGeometry geom = validateFoldGeometry(start, end);
@@ -329,6 +334,7 @@ bool Paper::fold(const vec2& start, const vec2& end) {
 }
 
 bool Paper::unfold(const vec2& pos) {
+    ScratchScope scratch;
     activateFold(pos);
     
     // Before popping the fold, check which enemies are in the fold underside region
@@ -343,14 +349,14 @@ bool Paper::unfold(const vec2& pos) {
     bool hasCrease = false;
     
     if (activeFold >= 0 && activeFold < folds.size()) {
-        Fold& activeFoldRef = folds[activeFold];
-        if (activeFoldRef.underside != nullptr) {
+        FoldRecord& activeFoldRef = folds[activeFold];
+        {
             // Check all enemies on the current side
             auto& enemies = currentSide->getEnemies();
             for (Enemy* enemy : enemies) {
                 if (enemy == nullptr || enemy->isDead()) continue;
                 vec2 enemyPos = enemy->getPosition();
-                if (activeFoldRef.underside->contains(enemyPos)) {
+                if (activeFoldRef.underside.contains(enemyPos)) {
                     enemiesToMove.push_back(enemy);
                 }
             }
@@ -360,7 +366,7 @@ bool Paper::unfold(const vec2& pos) {
             for (Pickup* pickup : pickups) {
                 if (pickup == nullptr) continue;
                 vec2 pickupPos = pickup->getPosition();
-                if (activeFoldRef.underside->contains(pickupPos)) {
+                if (activeFoldRef.underside.contains(pickupPos)) {
                     pickupsToMove.push_back(pickup);
                 }
             }
@@ -440,6 +446,72 @@ bool Paper::unfold(const vec2& pos) {
     return check;
 }
 
+/**
+ * @brief Whether a fold cover reaches off the paper, as the area of cover - paper. Used by pushFold, previewFold runs
+ * the analytic coverEdgesOutside on every mouse move instead
+ */
+static bool coverOverhangs(const std::vector<vec2>& coverRegion, const std::vector<vec2>& paperRegion) {
+    Paths64 coverPath = makePaths64FromRegion(coverRegion);
+    Paths64 paperPath = makePaths64FromRegion(paperRegion);
+    Paths64 overhangPath;
+    try {
+        overhangPath = Difference(coverPath, paperPath, FillRule::NonZero);
+    } catch (...) {
+        std::cout << "coverOverhangs: Exception while computing overhang Difference()" << std::endl;
+        overhangPath.clear();
+    }
+
+    // Filter out degenerate / tiny overhang regions based on polygon area.
+    const float OVERHANG_AREA_EPS = 1e-4f;
+    for (const Path64& path : overhangPath) {
+        if (path.size() < 3) continue;
+
+        float area = 0.0f;
+        for (size_t i = 0; i < path.size(); ++i) {
+            const Point64& p0 = path[i];
+            const Point64& p1 = path[(i + 1) % path.size()];
+            float x0 = static_cast<float>(p0.x / CLIPPER_SCALE), y0 = static_cast<float>(p0.y / CLIPPER_SCALE);
+            float x1 = static_cast<float>(p1.x / CLIPPER_SCALE), y1 = static_cast<float>(p1.y / CLIPPER_SCALE);
+            area += x0 * y1 - x1 * y0;
+        }
+        if (std::fabs(0.5f * area) >= OVERHANG_AREA_EPS) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Marks the cover edges that leave the paper without any booleans. Each edge is split where it meets the outline 
+ * and the middle of every piece is tested, so an edge spanning a concave notch is caught even with both ends on the paper.
+ * O(cover edges * outline edges), cheap enough for every mouse move
+ * @param edgeOut output, edgeOut[i] is set for the edge from cover[i] to cover[i + 1]
+ * @return whether any edge leaves the paper
+ */
+static bool coverEdgesOutside(const std::vector<vec2>& cover, const PaperMesh* paperMesh, std::vector<bool>& edgeOut) {
+    const float OVERHANG_EPS = 1e-3f;
+    const std::vector<vec2>& outline = paperMesh->region;
+
+    edgeOut.assign(cover.size(), false);
+    bool any = false;
+    std::vector<float> splits;
+    for (size_t i = 0; i < cover.size(); ++i) {
+        const vec2& a = cover[i];
+        const vec2& b = cover[(i + 1) % cover.size()];
+
+        splits = { 0.0f, 1.0f };
+        for (size_t k = 0; k < outline.size(); ++k) {
+            float t;
+            if (lineSegmentsIntersect(a, b, outline[k], outline[(k + 1) % outline.size()], t)) splits.push_back(t);
+        }
+        std::sort(splits.begin(), splits.end());
+
+        for (size_t s = 0; s + 1 < splits.size() && !edgeOut[i]; ++s) {
+            edgeOut[i] = paperMesh->isPointOutside(a + (b - a) * (0.5f * (splits[s] + splits[s + 1])), OVERHANG_EPS);
+        }
+        any = any || edgeOut[i];
+    }
+    return any;
+}
+
 bool Paper::pushFold(Fold& newFold) {
     // Safety check: reject fold if player is in the fold underside region (the part that gets folded underneath)
     SingleSide* currentSide = getSingleSide();
@@ -463,67 +535,81 @@ bool Paper::pushFold(Fold& newFold) {
     // These will be moved to the center of the cover region (but only if fold succeeds)
     std::vector<std::pair<Enemy*, vec2>> enemiesInUnderside;  // Enemy and target center position
     std::vector<std::pair<Pickup*, vec2>> pickupsInUnderside;  // Pickup and target center position
+    // Positions are gathered per list and tested against the fold in one batch
+    std::vector<vec2> positions;
+    std::vector<uint8_t> inside;
+    auto testEnemies = [&](const DyMesh& mesh, const std::vector<Enemy*>& enemies) {
+        positions.clear();
+        for (Enemy* enemy : enemies) {
+            if (enemy == nullptr || enemy->isDead()) continue;
+            positions.push_back(enemy->getPosition());
+        }
+        inside.resize(positions.size());
+        mesh.containsMany(positions, inside);
+    };
+    auto testPickups = [&](const DyMesh& mesh, const std::vector<Pickup*>& pickups) {
+        positions.clear();
+        for (Pickup* pickup : pickups) {
+            if (pickup == nullptr) continue;
+            positions.push_back(pickup->getPosition());
+        }
+        inside.resize(positions.size());
+        mesh.containsMany(positions, inside);
+    };
+
     if (currentSide && newFold.underside != nullptr && newFold.cover != nullptr) {
+        // Calculate center of cover region as average of vertices
+        const std::vector<vec2>& coverRegion = newFold.cover->region;
+        vec2 center(0.0f, 0.0f);
+        for (const vec2& v : coverRegion) {
+            center += v;
+        }
+        if (!coverRegion.empty()) center /= static_cast<float>(coverRegion.size());
+
         auto& enemies = currentSide->getEnemies();
+        testEnemies(*newFold.underside, enemies);
+        size_t next = 0;
         for (Enemy* enemy : enemies) {
             if (enemy == nullptr || enemy->isDead()) continue;
-            vec2 enemyPos = enemy->getPosition();
-            if (newFold.underside->contains(enemyPos)) {
-                // Calculate center of cover region as average of vertices
-                const std::vector<vec2>& coverRegion = newFold.cover->region;
-                if (!coverRegion.empty()) {
-                    vec2 center(0.0f, 0.0f);
-                    for (const vec2& v : coverRegion) {
-                        center += v;
-                    }
-                    center /= static_cast<float>(coverRegion.size());
-                    enemiesInUnderside.push_back({enemy, center});
-                }
+            if (inside[next++] && !coverRegion.empty()) {
+                enemiesInUnderside.push_back({enemy, center});
             }
         }
         
         // Collect pickups on the current side that are in the fold underside region
         auto& pickups = currentSide->getPickups();
+        testPickups(*newFold.underside, pickups);
+        next = 0;
         for (Pickup* pickup : pickups) {
             if (pickup == nullptr) continue;
-            vec2 pickupPos = pickup->getPosition();
-            if (newFold.underside->contains(pickupPos)) {
-                // Calculate center of cover region as average of vertices
-                const std::vector<vec2>& coverRegion = newFold.cover->region;
-                if (!coverRegion.empty()) {
-                    vec2 center(0.0f, 0.0f);
-                    for (const vec2& v : coverRegion) {
-                        center += v;
-                    }
-                    center /= static_cast<float>(coverRegion.size());
-                    pickupsInUnderside.push_back({pickup, center});
-                }
+            if (inside[next++] && !coverRegion.empty()) {
+                pickupsInUnderside.push_back({pickup, center});
             }
         }
     }
     
     // Before pushing the fold, check which enemies on the back side are in the fold backside region
+    // The backside region is in the back side's coordinate system (x is negated)
+    // So we can check directly if the positions are in the backside region
     if (backSide && newFold.backside != nullptr) {
         // Check all enemies on the back side
         auto& enemies = backSide->getEnemies();
+        testEnemies(*newFold.backside, enemies);
+        size_t next = 0;
         for (Enemy* enemy : enemies) {
             if (enemy == nullptr || enemy->isDead()) continue;
-            vec2 enemyPos = enemy->getPosition();
-            // The backside region is in the back side's coordinate system (x is negated)
-            // So we can check directly if the enemy position is in the backside region
-            if (newFold.backside->contains(enemyPos)) {
+            if (inside[next++]) {
                 enemiesToMove.push_back(enemy);
             }
         }
         
         // Check all pickups on the back side
         auto& pickups = backSide->getPickups();
+        testPickups(*newFold.backside, pickups);
+        next = 0;
         for (Pickup* pickup : pickups) {
             if (pickup == nullptr) continue;
-            vec2 pickupPos = pickup->getPosition();
-            // The backside region is in the back side's coordinate system (x is negated)
-            // So we can check directly if the pickup position is in the backside region
-            if (newFold.backside->contains(pickupPos)) {
+            if (inside[next++]) {
                 pickupsToMove.push_back(pickup);
             }
         }
@@ -534,10 +620,10 @@ bool Paper::pushFold(Fold& newFold) {
 
     // iterate from top to bottom since covering folds will come after covered
     for (int i = insertIndex - 1; i >= 0; i--) {
-        Fold& fold = folds[i];
+        FoldRecord& fold = folds[i];
         
         // Check overlap with underside/backside based on which side the fold is on
-        if (fold.underside->hasOverlap(fold.side == curSide ? *newFold.underside : *newFold.backside)) {
+        if (fold.underside.hasOverlap(fold.side == curSide ? *newFold.underside : *newFold.backside)) {
             fold.holds.insert(insertIndex);
             continue;
         }
@@ -545,100 +631,43 @@ bool Paper::pushFold(Fold& newFold) {
         // For folds on the back side, also check if the crease line intersects their region
         if (fold.side != curSide) {
             // Check if the new fold's crease intersects the existing fold's backside region
-            if (lineSegmentIntersectsPolygon(newFold.crease[0], newFold.crease[1], fold.backside->region)) {
+            if (lineSegmentIntersectsPolygon(newFold.crease[0], newFold.crease[1], fold.backside.region)) {
                 fold.holds.insert(insertIndex);
             }
         }
     }
 
-    folds.push_back(newFold);
-
     // modify the mesh to accommodate new fold
     PaperMesh* paperMesh = getPaperMesh();
-    PaperMesh* paperCopy = new PaperMesh(*paperMesh);
+    PaperMesh* paperCopy = new PaperMesh(*paperMesh, false);
 
     bool check = paperCopy->cut(*newFold.underside);
     if (!check) {
         delete paperCopy; paperCopy = nullptr;
-        folds.pop_back();
         return false;
     }
 
     check = paperCopy->paste(*newFold.cover);
     if (!check) {
         delete paperCopy; paperCopy = nullptr;
-        folds.pop_back();
         return false;
     }
 
     // Handle back side
     PaperMesh* backMesh = getBackPaperMesh();
-    PaperMesh* backCopy = new PaperMesh(*backMesh);
+    PaperMesh* backCopy = new PaperMesh(*backMesh, false);
     check = backCopy->cut(*newFold.backside);
     if (!check) {
         delete paperCopy; paperCopy = nullptr;
         delete backCopy; backCopy = nullptr;
-        folds.pop_back();
         return false;
     }
 
-    // Calculate overhangs using the same method as previewFold:
-    // overhang = coverRegion - uncutPaperRegion.
-    const std::vector<vec2>& coverRegion = newFold.cover->region;
-    Paths64 coverPath = makePaths64FromRegion(coverRegion);
-    Paths64 paperPath = makePaths64FromRegion(paperMesh->region);
-    Paths64 overhangPath;
-    try {
-        overhangPath = Difference(coverPath, paperPath, FillRule::NonZero);
-    } catch (...) {
-        std::cout << "pushFold: Exception while computing overhang Difference()" << std::endl;
-        overhangPath.clear();
-    }
-
-    // Filter out degenerate / tiny overhang regions based on polygon area.
-    auto polygonArea = [](const std::vector<vec2>& pts) -> float {
-        if (pts.size() < 3) return 0.0f;
-        float a = 0.0f;
-        for (size_t i = 0; i < pts.size(); ++i) {
-            const vec2& p0 = pts[i];
-            const vec2& p1 = pts[(i + 1) % pts.size()];
-            a += p0.x * p1.y - p1.x * p0.y;
-        }
-        return 0.5f * a;
-    };
-
-    const float OVERHANG_AREA_EPS = 1e-4f;
-    bool hasOverhang = false;
-
-    for (size_t pathIdx = 0; pathIdx < overhangPath.size(); ++pathIdx) {
-        const Path64& path = overhangPath[pathIdx];
-        if (path.size() < 3) continue;
-
-        std::vector<vec2> pts;
-        pts.reserve(path.size());
-        for (const Point64& pt : path) {
-            pts.emplace_back(
-                static_cast<float>(pt.x / CLIPPER_SCALE),
-                static_cast<float>(pt.y / CLIPPER_SCALE)
-            );
-        }
-
-        float area = std::fabs(polygonArea(pts));
-        if (area < OVERHANG_AREA_EPS) {
-            std::cout << "pushFold: ignoring tiny overhang path, area=" << area << std::endl;
-            continue;
-        }
-
-        hasOverhang = true;
-        break;
-    }
-
-    if (hasOverhang) {
-        std::cout << "pushFold: rejecting fold due to overhangs. "
-                  << "numOverhangPaths=" << overhangPath.size() << std::endl;
+    // Reject covers that leave the paper, previewFold uses the same test
+    if (coverOverhangs(newFold.cover->region, paperMesh->region)) {
+        std::cout << "pushFold: rejecting fold due to overhangs" << std::endl;
         delete paperCopy; paperCopy = nullptr;
         delete backCopy;  backCopy  = nullptr;
-        folds.pop_back();
         return false;
     }
 
@@ -660,7 +689,9 @@ bool Paper::pushFold(Fold& newFold) {
     backCopy->region = cleanFlipped;
     backCopy->pruneDups();
 
-    // swap meshes with cut
+    // swap meshes with cut, the copies take over the old navmeshes so they can be patched below
+    paperCopy->adoptResources(*paperMesh);
+    backCopy->adoptResources(*backMesh);
     delete paperMesh;
     delete backMesh;
     
@@ -670,15 +701,24 @@ bool Paper::pushFold(Fold& newFold) {
         this->paperMeshes = { backCopy, paperCopy };
     }
 
-    pruneSmallObstacles();
+    // Only the fold's footprint changed, so the navmeshes are patched there instead of rebuilt
+    std::vector<std::pair<vec2, vec2>> frontDirty = { polygonBounds(newFold.underside->region), polygonBounds(newFold.cover->region) };
+    std::vector<std::pair<vec2, vec2>> backDirty = { polygonBounds(newFold.backside->region) };
+    auto& firstDirty = curSide == 0 ? frontDirty : backDirty;
+    auto& secondDirty = curSide == 0 ? backDirty : frontDirty;
+
+    pruneSmallObstacles(firstDirty, secondDirty);
     paperMeshes.first->regenerateMesh();
     paperMeshes.second->regenerateMesh();
-    paperMeshes.first->regenerateNavmesh();
-    paperMeshes.second->regenerateNavmesh();
+    paperMeshes.first->regenerateNavmesh(firstDirty);
+    paperMeshes.second->regenerateNavmesh(secondDirty);
     sides.first->getBackground()->setMesh(paperMeshes.first->mesh);
     sides.second->getBackground()->setMesh(paperMeshes.second->mesh);
     regenerateWalls();
 
+    // only the crease and the removed content are kept for undoing the fold
+    folds.emplace_back(newFold);
+
     // update active fold to be what we just made so we can hold onto it
     activeFold = folds.size() - 1;
 
@@ -778,13 +818,13 @@ bool Paper::popFold() {
     if (activeFold < 0 || activeFold >= folds.size() || folds[activeFold].isCovered()) return false;
 
     // restore mesh from fold
-    Fold& oldFold = folds[activeFold];
+    FoldRecord& oldFold = folds[activeFold];
     PaperMesh* paperMesh = getPaperMesh();
     PaperMesh* backMesh = getBackPaperMesh();
 
     // Find insertion point for original folded vertices
     // We need to find where the crease start point is in the current region
-    auto regionCopy = paperMesh->region;
+    std::vector<vec2> regionCopy = paperMesh->region;
     size_t insertPos = regionCopy.size(); // Default to end if not found
     bool foundCrease = false;
     
@@ -812,29 +852,30 @@ bool Paper::popFold() {
     // Simplify collinear vertices after inserting
     regionCopy = simplifyCollinear(regionCopy);
 
-    // Remove cover region from front paper
-    bool check = paperMesh->cut(*oldFold.cover);
+    // Remove cover region from front paper, the record only keeps the backside it was mirrored from
+    DyMesh cover = oldFold.makeCover();
+    bool check = paperMesh->cut(cover);
     if (!check) {
         std::cout << "popFold: Failed to cut cover region" << std::endl;
         return false;
     }
     
     // Restore underside region to front paper
-    check = paperMesh->paste(*oldFold.underside);
+    check = paperMesh->paste(oldFold.underside);
     if (!check) {
         std::cout << "popFold: Failed to paste underside region" << std::endl;
         return false;
     }
     
     // Restore backside region to back paper
-    check = backMesh->paste(*oldFold.backside);
+    check = backMesh->paste(oldFold.backside);
     if (!check) {
         std::cout << "popFold: Failed to paste backside region" << std::endl;
         return false;
     }
 
     // Remove references TO the activeFold from other folds' holds
-    for (Fold& fold : folds) {
+    for (FoldRecord& fold : folds) {
         if (fold.holds.find(activeFold) != fold.holds.end()) {
             fold.holds.erase(activeFold);
         }
@@ -859,16 +900,22 @@ bool Paper::popFold() {
     // Save crease information before erasing the fold (since oldFold reference becomes invalid)
     vec2 creaseStart = oldFold.crease[0];
     vec2 creaseEnd = oldFold.crease[1];
+
+    // Only the fold's footprint changes, so the navmeshes are patched there instead of rebuilt
+    std::vector<std::pair<vec2, vec2>> frontDirty = { polygonBounds(oldFold.underside.region), polygonBounds(cover.region) };
+    std::vector<std::pair<vec2, vec2>> backDirty = { polygonBounds(oldFold.backside.region) };
+    auto& firstDirty = curSide == 0 ? frontDirty : backDirty;
+    auto& secondDirty = curSide == 0 ? backDirty : frontDirty;
     
     // Clear all holds that the removed fold had on other folds
     oldFold.holds.clear();
     folds.erase(folds.begin() + activeFold);
 
-    pruneSmallObstacles();
+    pruneSmallObstacles(firstDirty, secondDirty);
     paperMeshes.first->regenerateMesh();
     paperMeshes.second->regenerateMesh();
-    paperMeshes.first->regenerateNavmesh();
-    paperMeshes.second->regenerateNavmesh();
+    paperMeshes.first->regenerateNavmesh(firstDirty);
+    paperMeshes.second->regenerateNavmesh(secondDirty);
     sides.first->getBackground()->setMesh(paperMeshes.first->mesh);
     sides.second->getBackground()->setMesh(paperMeshes.second->mesh);
     regenerateWalls();
@@ -901,7 +948,7 @@ void Paper::regenerateWalls() {
 }
 
 void Paper::regenerateWalls(int side) {
-    std::vector<vec2>& region = (side == 0) ? paperMeshes.first->region : paperMeshes.second->region;
+    const std::vector<vec2>& region = (side == 0) ? paperMeshes.first->region : paperMeshes.second->region;
     SingleSide* selectedSide = (side == 0) ? sides.first : sides.second;
     PaperMesh* selectedMesh = (side == 0) ? paperMeshes.first : paperMeshes.second;
     selectedSide->clearWalls();
@@ -973,7 +1020,7 @@ void Paper::regenerateWalls(int side) {
     }
 }
 
-void Paper::pruneSmallObstacles() {
+void Paper::pruneSmallObstacles(std::vector<std::pair<vec2, vec2>>& firstDirty, std::vector<std::pair<vec2, vec2>>& secondDirty) {
     const float MIN_TOTAL_SIDE_LENGTH = 0.25f;
     
     // Helper function to calculate total side lengths (perimeter) of a polygon
@@ -997,10 +1044,10 @@ void Paper::pruneSmallObstacles() {
                 float totalLength = calculateTotalSideLength(region.positions);
                 if (totalLength < MIN_TOTAL_SIDE_LENGTH) {
                     region.isObstacle = false;
+                    firstDirty.push_back(polygonBounds(region.positions));
                 }
             }
         }
-        paperMeshes.first->regenerateNavmesh();
     }
     
     // Prune obstacles from second side
@@ -1011,10 +1058,10 @@ void Paper::pruneSmallObstacles() {
                 float totalLength = calculateTotalSideLength(region.positions);
                 if (totalLength < MIN_TOTAL_SIDE_LENGTH) {
                     region.isObstacle = false;
+                    secondDirty.push_back(polygonBounds(region.positions));
                 }
             }
         }
-        paperMeshes.second->regenerateNavmesh();
     }
 }
 
@@ -1090,6 +1137,17 @@ void Paper::resetGeometry() {
     regenerateWalls();
 }
 
+/**
+ * @brief Debug, bytes held by the fold history
+ */
+size_t Paper::getFoldBytes() const {
+    size_t bytes = 0;
+    for (const FoldRecord& fold : folds) {
+        bytes += fold.bytes;
+    }
+    return bytes;
+}
+
 void Paper::dotData() {
     // Clear existing debug nodes
     for (uint i = 0; i < regionNodes.size(); i++) {
@@ -1143,75 +1201,23 @@ void Paper::previewFold(const vec2& start, const vec2& end) {
         return;
     }
 
-    // Check if player is in fold using validateFoldGeometry
-    FoldGeometry geom = validateFoldGeometry(start, end);
-    bool playerInFold = geom.playerInFold;
-
-    Fold tempFold(start, curSide);
-    // Try to initialize - even if it fails, cover might still be created
-    bool check = tempFold.initialize(
-        curSide == 0 ? paperMeshes : PaperMeshPair{ paperMeshes.second, paperMeshes.first },
-        creasePos,
-        foldDir,
-        edgeIntersectPaper
-    );
-    
-    // Show cover even if initialize returned false, as long as cover is valid
-    if (tempFold.cover != nullptr && !tempFold.cover->region.empty() && tempFold.cover->region.size() >= 3) {
-        // Detect overhangs by subtracting the uncut paper region from the cover region:
-        // overhang = coverRegion - paperRegion
-        const std::vector<vec2>& coverRegion = tempFold.cover->region;
-        Paths64 coverPath = makePaths64FromRegion(coverRegion);
-        Paths64 paperPath = makePaths64FromRegion(paperMesh->region);
-
-        Paths64 overhangPath;
-        try {
-            overhangPath = Difference(coverPath, paperPath, FillRule::NonZero);
-        } catch (...) {
-            overhangPath.clear();
-        }
-
-        // Filter out degenerate / tiny overhang regions based on polygon area.
-        auto polygonArea = [](const std::vector<vec2>& pts) -> float {
-            if (pts.size() < 3) return 0.0f;
-            float a = 0.0f;
-            for (size_t i = 0; i < pts.size(); ++i) {
-                const vec2& p0 = pts[i];
-                const vec2& p1 = pts[(i + 1) % pts.size()];
-                a += p0.x * p1.y - p1.x * p0.y;
-            }
-            return 0.5f * a;
-        };
-
-        const float OVERHANG_AREA_EPS = 1e-4f;
-        bool hasOverhang = false;
-
-        // We will reuse non-degenerate overhang polygons when drawing red outlines.
-        std::vector<std::vector<vec2>> nonDegenerateOverhangs;
-
-        for (size_t pathIdx = 0; pathIdx < overhangPath.size(); ++pathIdx) {
-            const Path64& path = overhangPath[pathIdx];
-            if (path.size() < 3) continue;
+    // Preview runs on every mouse move, so the cover is taken from the outline in O(n) instead of the full
+    // fold pipeline. fold() still runs the exact pipeline on release
+    std::vector<vec2> coverRegion;
+    paperMesh->getFoldCover(creasePos, foldDir, edgeIntersectPaper, coverRegion);
 
-            std::vector<vec2> pts;
-            pts.reserve(path.size());
-            for (const Point64& pt : path) {
-                pts.emplace_back(
-                    static_cast<float>(pt.x / CLIPPER_SCALE),
-                    static_cast<float>(pt.y / CLIPPER_SCALE)
-                );
-            }
-
-            float area = std::fabs(polygonArea(pts));
-            if (area < OVERHANG_AREA_EPS) {
-                // Very small sliver – treat as numerical noise.
-                continue;
-            }
-
-            hasOverhang = true;
-            nonDegenerateOverhangs.push_back(std::move(pts));
+    if (coverRegion.size() >= 3) {
+        // The underside is the paper under the cover and the player is always on the paper
+        bool playerInFold = false;
+        SingleSide* currentSide = getSingleSide();
+        if (currentSide && currentSide->getPlayerNode()) {
+            playerInFold = !Edger(coverRegion).isPointOutside(currentSide->getPlayerNode()->getPosition());
         }
 
+        // Cover edges leaving the paper mark an overhang, pushFold checks the same thing with Clipper on release
+        std::vector<bool> overhangs;
+        bool hasOverhang = coverEdgesOutside(coverRegion, paperMesh, overhangs);
+
         const char* baseMatName = nullptr;
         if (hasOverhang) {
             baseMatName = "yellow";
@@ -1239,28 +1245,23 @@ void Paper::previewFold(const vec2& start, const vec2& end) {
             regionNodes.push_back(edge);
         }
 
-        // If we have overhangs, render their boundaries in red on top of the base preview.
+        // If we have overhangs, render the cover edges that leave the paper in red on top of the base preview.
         if (hasOverhang) {
-            for (const auto& overhangPositionsRaw : nonDegenerateOverhangs) {
-                if (overhangPositionsRaw.size() < 2) continue;
-
-                std::vector<vec2> overhangPositions = overhangPositionsRaw;
-                ensureCCW(overhangPositions);
-
-                for (int i = 0; i < static_cast<int>(overhangPositions.size()); ++i) {
-                    int j = (i + 1) % static_cast<int>(overhangPositions.size());
-                    auto edgeData = connectSquare(overhangPositions[i], overhangPositions[j]);
-
-                    Node2D* edge = new Node2D(game->getScene(), {
-                        .mesh = game->getMesh("quad"),
-                        .material = game->getMaterial("red"),
-                        .position = vec2{edgeData.first.x, edgeData.first.y},
-                        .rotation = edgeData.first.z,
-                        .scale = edgeData.second
-                    });
-                    edge->setLayer(0.97f); // slightly above base preview
-                    regionNodes.push_back(edge);
-                }
+            for (int i = 0; i < static_cast<int>(coverRegion.size()); ++i) {
+                int j = (i + 1) % static_cast<int>(coverRegion.size());
+                if (!overhangs[i]) continue;
+
+                auto edgeData = connectSquare(coverRegion[i], coverRegion[j]);
+
+                Node2D* edge = new Node2D(game->getScene(), {
+                    .mesh = game->getMesh("quad"),
+                    .material = game->getMaterial("red"),
+                    .position = vec2{edgeData.first.x, edgeData.first.y},
+                    .rotation = edgeData.first.z,
+                    .scale = edgeData.second
+                });
+                edge->setLayer(0.97f); // slightly above base preview
+                regionNodes.push_back(edge);
             }
         }
         
@@ -1299,73 +1300,122 @@ void Paper::previewFold(const vec2& start, const vec2& end) {
     }
 }
 
-void Paper::padCornerWaypoints(std::vector<vec2>& path, float padding) {
-    if (path.size() < 3) return; // Need at least start, corner, end
-    
-    // Process corner waypoints (skip first and last)
-    for (size_t i = 1; i < path.size() - 1; i++) {
-        vec2& corner = path[i];
-        const vec2& prev = path[i - 1];
-        const vec2& next = path[i + 1];
-        
-        // Calculate directions from corner to previous and next waypoints
-        vec2 toPrev = prev - corner;
-        vec2 toNext = next - corner;
-        
-        float lenToPrev = glm::length(toPrev);
-        float lenToNext = glm::length(toNext);
-        
-        // Skip if directions are degenerate
-        if (lenToPrev < EPSILON || lenToNext < EPSILON) continue;
-        
-        // Normalize directions
-        toPrev /= lenToPrev;
-        toNext /= lenToNext;
-        
-        // Calculate the angle bisector - average of the two normalized directions
-        // This points away from the corner, opening up the turn
-        vec2 bisector = toPrev + toNext;
-        float bisectorLen = glm::length(bisector);
-        
-        // If the two directions are opposite (collinear path), skip padding
-        if (bisectorLen < EPSILON) continue;
-        
-        bisector /= bisectorLen;
-        
-        // Offset the corner waypoint outward along the bisector by the padding distance
-        corner += bisector * padding;
-    }
-}
-
-
-void Paper::updatePathing(vec2 playerPos) {
+/**
+ * @brief Refreshes enemy paths on the current side within the scheduler's per-frame budget, called every frame. 
+ * The flow field is rebuilt only when the player moves into another triangle.
+ */
+void Paper::updatePathing(vec2 playerPos, float dt) {
     SingleSide* side = (curSide == 0) ? sides.first : sides.second;
     PaperMesh* mesh = (curSide == 0) ? paperMeshes.first : paperMeshes.second;
 
+    PaperMesh* backMesh = (curSide == 0) ? paperMeshes.second : paperMeshes.first;
+
+    // One search from the player serves every enemy chasing them, the back side has no player to chase
+    int playerTriangle = mesh->locateTriangle(playerPos);
+    if (!useFlowField) {
+        mesh->clearFlowField();
+    } else if (playerTriangle != mesh->getFlowGoal()) {
+        mesh->buildFlowField(playerPos);
+    }
+    backMesh->clearFlowField();
+
     for (Enemy* enemy : side->getEnemies()) {
-        // Kill enemies that are outside the paperMesh region
-        if (!enemy->isDead() && !mesh->contains(enemy->getPosition())) {
+        if (enemy->isDead()) continue;
+
+        // Kill enemies that are outside the paperMesh region, every frame rather than when their path is refreshed
+        if (!mesh->contains(enemy->getPosition())) {
             // Instantly kill by dealing damage equal to max health
             enemy->onDamage(enemy->getMaxHealth());
-            continue; // Skip pathing for dead enemies
+            continue;
         }
-        
-        // Determine target position: use custom destination if set, otherwise use player position
-        vec2 targetPos = playerPos;
+
+        float& age = enemy->getPathAge();
+        age += dt;
+
         std::optional<vec2> customDest = enemy->getCustomDestination();
-        if (customDest.has_value()) {
-            targetPos = customDest.value();
+        int targetTriangle = customDest.has_value() ? mesh->locateTriangle(customDest.value()) : playerTriangle;
+        bool targetChanged = targetTriangle != enemy->getPathTargetTriangle();
+
+        // Recent paths are kept, and a search still in flight is left to finish, a new request would cancel it
+        if (!targetChanged && (age < pathScheduler.getBudget().minInterval || enemy->getPathRequest() != 0)) continue;
+
+        pathScheduler.add(enemy, age, glm::length(enemy->getPosition() - playerPos), targetChanged);
+    }
+
+    pathScheduler.run([&](Enemy* enemy) {
+        return refreshPath(enemy, mesh, playerPos, playerTriangle);
+    });
+}
+
+/**
+ * @brief Replans a single enemy's path toward its custom destination or the player
+ * @return the work the refresh cost, charged against the scheduler's budget
+ */
+PathScheduler::Cost Paper::refreshPath(Enemy* enemy, PaperMesh* mesh, vec2 playerPos, int playerTriangle) {
+    PathScheduler::Cost cost;
+    enemy->getPathAge() = 0.0f;
+
+    // Determine target position: use custom destination if set, otherwise use player position
+    vec2 targetPos = playerPos;
+    std::optional<vec2> customDest = enemy->getCustomDestination();
+    if (customDest.has_value()) {
+        targetPos = customDest.value();
+    }
+    enemy->getPathTargetTriangle() = customDest.has_value() ? mesh->locateTriangle(targetPos) : playerTriangle;
+    
+    std::vector<vec2> path;
+    // Pass enemy radius + a bit extra for portal padding (1.2x radius for safety margin)
+    float padding = enemy->getRadius() * 1.2f;
+
+    // Enemies heading for the player read the flow field, custom destinations still need their own search
+    vec2 waypoint;
+    if (!customDest.has_value() && mesh->getFlowWaypoint(enemy->getPosition(), playerPos, waypoint, padding)) {
+        path = { enemy->getPosition(), waypoint };
+        if (glm::length2(waypoint - playerPos) > 1e-6f) {
+            path.push_back(playerPos);
         }
-        
-        std::vector<vec2> path;
-        // Pass enemy radius + a bit extra for portal padding (1.2x radius for safety margin)
-        float padding = enemy->getRadius() * 1.2f;
+    } else if (asyncPathing) {
+        // Result is handed over by deliverPaths on a later frame, replacing any request still in flight
+        enemy->setPathRequest(PathWorkers::get().request(mesh->getNavmeshSnapshot(), enemy->getPosition(), targetPos, padding, enemy->getPathRequest()));
+        cost.requests = 1;
+        return cost;
+    } else {
         mesh->getPath(path, enemy->getPosition(), targetPos, padding);
-        
-        // Add padding to corner waypoints so enemies don't get caught
-        padCornerWaypoints(path, enemy->getRadius());
-        
-        enemy->setPath(path);
+        cost.expansions = mesh->getLastPathExpansions();
+    }
+
+    // This path supersedes anything still being searched for the enemy
+    PathWorkers::get().cancel(enemy->getPathRequest());
+    enemy->setPathRequest(0);
+
+    // Corners already keep padding from the walls, the portals were shrunk by it before the funnel
+    enemy->setPath(path);
+    return cost;
+}
+
+/**
+ * @brief Hands finished asynchronous path requests to their enemies. Paths planned on a navmesh 
+ * that has since changed (a fold, or the enemy switching sides) are dropped.
+ */
+void Paper::deliverPaths() {
+    PathWorkers& workers = PathWorkers::get();
+    std::vector<vec2> path;
+
+    for (auto [side, mesh] : { std::make_pair(sides.first, paperMeshes.first), std::make_pair(sides.second, paperMeshes.second) }) {
+        if (side == nullptr || mesh == nullptr) continue;
+        uint version = mesh->getNavmeshVersion();
+
+        for (Enemy* enemy : side->getEnemies()) {
+            if (enemy == nullptr || enemy->getPathRequest() == 0) continue;
+
+            PathWorkers::Status status = workers.poll(enemy->getPathRequest(), version, path);
+            if (status == PathWorkers::Status::PENDING) continue;
+
+            enemy->setPathRequest(0);
+            if (status == PathWorkers::Status::READY) {
+                enemy->setPath(path);
+            }
+        }
     }
 }
 
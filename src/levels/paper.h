@@ -7,6 +7,7 @@
 #include "levels/edger.h"
 #include "levels/dymesh.h"
 #include "levels/paperMesh.h"
+#include "levels/pathScheduler.h"
 
 class Game;
 
@@ -50,10 +51,31 @@ private:
         bool isCovered() { return holds.size() > 0; }
     };
 
+    // Fold history entry, only what popFold needs to undo a fold: the crease and the content it took off 
+    // each side. The cover is the backside mirrored over the crease, so it is rebuilt instead of stored.
+    // The content taken off is in neither mesh after the fold and has to be kept, minus its rebuildable caches
+    struct FoldRecord {
+        DyMesh underside; // front content under the fold, pasted back on pop
+        DyMesh backside;  // back content folded over, pasted back on pop
+        std::vector<vec2> originalFoldedVerts; // outline vertices the fold removed from the front
+        std::set<int> holds;
+        int side;
+        Vec2Pair crease;
+        vec2 creasePos;
+        vec2 creaseDir;
+        size_t bytes; // debug, heap and inline bytes held by this record
+
+        FoldRecord(const Fold& fold);
+
+        DyMesh makeCover() const;
+        bool coverContains(const vec2& pos) const;
+        bool isCovered() { return holds.size() > 0; }
+    };
+
 public: // DEBUG
     
     // tracking folding
-    std::vector<Fold> folds; // TODO, switch to ptrs
+    std::vector<FoldRecord> folds;
     int activeFold = NULL_FOLD;
 
     // side pairs
@@ -69,6 +91,15 @@ public: // DEBUG
     bool isOpen;
     bool hasBeenVisited = false;  // Track if player has visited this paper before
 
+    // chasing enemies share one flow field toward the player instead of running A* each
+    bool useFlowField = true;
+
+    // remaining searches run on PathWorkers and are delivered on a later frame
+    bool asyncPathing = true;
+
+    // spreads path refreshes across frames under a per-frame budget
+    PathScheduler pathScheduler;
+
 public:
     Paper();
     Paper(Game* game, std::pair<std::string, std::string> sideNames, std::pair<std::string, std::string> obstacleNames, float difficulty = 0.0f);
@@ -119,7 +150,7 @@ public:
     void deactivateFold();
     void regenerateWalls();
     void regenerateWalls(int side);
-    void pruneSmallObstacles(); // Remove obstacle UVRegions with total side lengths < 0.25
+    void pruneSmallObstacles(std::vector<std::pair<vec2, vec2>>& firstDirty, std::vector<std::pair<vec2, vec2>>& secondDirty); // Remove obstacle UVRegions with total side lengths < 0.25, recording their bounds
     void resetGeometry();
 
     void setGame(Game* game) { this->game = game; }
@@ -127,12 +158,16 @@ public:
     void toData(std::vector<float>& out);
 
     // enemies
-    void updatePathing(vec2 playerPos);
+    void updatePathing(vec2 playerPos, float dt);
+    void deliverPaths(); // hand finished asynchronous paths to enemies, called every frame
+    PathScheduler& getPathScheduler() { return pathScheduler; }
     void checkAndSetOpen(); // Check if all enemies are defeated and set isOpen
     void killAllEnemies(); // Kill all enemies on both sides
 
     // DEBUG
     void dotData();
+    size_t getFoldBytes() const;
+    size_t getBytesPerFold() const { return folds.empty() ? 0 : getFoldBytes() / folds.size(); }
 
 private:
     // Shared fold validation and geometry calculation
@@ -159,7 +194,7 @@ private:
     bool pushFold(Fold& newFold);
     bool popFold(); // uses activeFold index
     
-    void padCornerWaypoints(std::vector<vec2>& path, float padding);
+    PathScheduler::Cost refreshPath(Enemy* enemy, PaperMesh* mesh, vec2 playerPos, int playerTriangle);
 };
 
 #endif
\ No newline at end of file
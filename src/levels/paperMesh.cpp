@@ -23,9 +23,13 @@ PaperMesh::~PaperMesh() {
     navmesh = nullptr;
 }
 
-PaperMesh::PaperMesh(const PaperMesh& other) 
+PaperMesh::PaperMesh(const PaperMesh& other) : PaperMesh(other, true) {}
+
+PaperMesh::PaperMesh(const PaperMesh& other, bool buildResources) 
     : DyMesh(other.region, other.regions), mesh(nullptr), navmesh(nullptr), startingRegion(other.startingRegion)
 {
+    if (!buildResources) return;
+
     std::vector<float> data;
     toData(data);
     mesh = new Mesh(data);
@@ -38,7 +42,15 @@ PaperMesh::PaperMesh(PaperMesh&& other) noexcept
     : DyMesh(std::move(other.region), std::move(other.regions)), 
       mesh(other.mesh), 
       navmesh(other.navmesh),
-      startingRegion(other.startingRegion)
+      navmeshSnapshot(std::move(other.navmeshSnapshot)),
+      startingRegion(other.startingRegion),
+      sightEdges(std::move(other.sightEdges)),
+      sightStart(std::move(other.sightStart)),
+      sightCells(std::move(other.sightCells)),
+      sightMin(other.sightMin),
+      sightCellSize(other.sightCellSize),
+      sightWidth(other.sightWidth),
+      sightHeight(other.sightHeight)
 {
     other.mesh = nullptr;
     other.navmesh = nullptr;
@@ -55,9 +67,12 @@ PaperMesh& PaperMesh::operator=(const PaperMesh& other) {
     
     mesh = temp.mesh;
     navmesh = temp.navmesh;
+    navmeshSnapshot = std::move(temp.navmeshSnapshot);
     region = std::move(temp.region);
     regions = std::move(temp.regions);
     startingRegion = std::move(temp.startingRegion);
+    buildSightGrid();
+    invalidateRegionTree();
     
     temp.mesh = nullptr;
     temp.navmesh = nullptr;
@@ -74,8 +89,17 @@ PaperMesh& PaperMesh::operator=(PaperMesh&& other) noexcept {
     region = std::move(other.region);
     regions = std::move(other.regions);
     startingRegion = std::move(other.startingRegion);
+    invalidateRegionTree();
     mesh = other.mesh;
     navmesh = other.navmesh;
+    navmeshSnapshot = std::move(other.navmeshSnapshot);
+    sightEdges = std::move(other.sightEdges);
+    sightStart = std::move(other.sightStart);
+    sightCells = std::move(other.sightCells);
+    sightMin = other.sightMin;
+    sightCellSize = other.sightCellSize;
+    sightWidth = other.sightWidth;
+    sightHeight = other.sightHeight;
     
     other.mesh = nullptr;
     other.navmesh = nullptr;
@@ -83,6 +107,20 @@ PaperMesh& PaperMesh::operator=(PaperMesh&& other) noexcept {
     return *this;
 }
 
+void PaperMesh::adoptResources(PaperMesh& other) {
+    if (this == &other) return;
+
+    delete mesh;
+    delete navmesh;
+
+    mesh = other.mesh;
+    navmesh = other.navmesh;
+    navmeshSnapshot = std::move(other.navmeshSnapshot);
+
+    other.mesh = nullptr;
+    other.navmesh = nullptr;
+}
+
 void PaperMesh::regenerateMesh() {
     Mesh* oldPaperMesh = mesh;
     std::vector<float> newMeshData;
@@ -95,6 +133,26 @@ void PaperMesh::regenerateNavmesh() {
     if (!navmesh) return;
     
     navmesh->clear();
+    addNavmeshRings();
+    navmesh->generateNavmesh();
+    navmeshSnapshot = std::make_shared<const Navmesh>(*navmesh);
+    buildSightGrid();
+    invalidateRegionTree();
+}
+
+void PaperMesh::regenerateNavmesh(const std::vector<std::pair<vec2, vec2>>& dirty) {
+    if (!navmesh) return;
+
+    // Keep the old triangles, only those inside the dirty boxes get rebuilt
+    navmesh->resetMesh();
+    addNavmeshRings();
+    navmesh->generateNavmesh(dirty);
+    navmeshSnapshot = std::make_shared<const Navmesh>(*navmesh);
+    buildSightGrid();
+    invalidateRegionTree();
+}
+
+void PaperMesh::addNavmeshRings() {
     navmesh->addMesh(region);
     
     // Add only UV regions marked as obstacles
@@ -103,30 +161,278 @@ void PaperMesh::regenerateNavmesh() {
             navmesh->addObstacle(uvRegion.positions);
         }
     }
-    
-    navmesh->generateNavmesh();
 }
 
-bool PaperMesh::hasLineOfSight(const vec2& start, const vec2& end) const {
-    // Check if the line segment intersects any obstacle edge
+/**
+ * @brief Buckets the edges of every obstacle UVRegion into a uniform grid, sized so that a cell holds 
+ * a couple of edges on average. Called whenever the regions are regenerated.
+ */
+void PaperMesh::buildSightGrid() {
+    sightEdges.clear();
+    sightStart.clear();
+    sightCells.clear();
+    sightWidth = sightHeight = 0;
+
+    vec2 lo = vec2{ std::numeric_limits<float>::infinity() };
+    vec2 hi = vec2{ -std::numeric_limits<float>::infinity() };
     for (const auto& uvRegion : regions) {
-        // Only check regions marked as obstacles
-        if (!uvRegion.isObstacle) {
-            continue;
+        // Skip non obstacles and regions with insufficient vertices
+        if (!uvRegion.isObstacle || uvRegion.positions.size() < 3) continue;
+
+        const std::vector<vec2>& polygon = uvRegion.positions;
+        for (size_t i = 0; i < polygon.size(); i++) {
+            sightEdges.push_back({ polygon[i], polygon[(i + 1) % polygon.size()] });
+            lo = glm::min(lo, polygon[i]);
+            hi = glm::max(hi, polygon[i]);
         }
-        
-        // Skip regions with insufficient vertices
-        if (uvRegion.positions.size() < 3) {
+    }
+
+    if (sightEdges.empty()) return;
+
+    // Roughly square cells, about one cell per edge
+    vec2 size = glm::max(hi - lo, vec2(EPSILON));
+    float cellSize = std::sqrt(size.x * size.y / sightEdges.size());
+    cellSize = std::max(cellSize, std::max(size.x, size.y) / 64.0f);
+    sightWidth = std::clamp((uint)std::ceil(size.x / cellSize), 1u, 64u);
+    sightHeight = std::clamp((uint)std::ceil(size.y / cellSize), 1u, 64u);
+    sightMin = lo;
+    sightCellSize = size / vec2(sightWidth, sightHeight);
+
+    // Count then fill every cell touched by an edge's bounding box
+    auto cellRange = [&](const std::pair<vec2, vec2>& edge, uint& x0, uint& y0, uint& x1, uint& y1) {
+        vec2 a = (glm::min(edge.first, edge.second) - sightMin) / sightCellSize;
+        vec2 b = (glm::max(edge.first, edge.second) - sightMin) / sightCellSize;
+        x0 = std::min((uint)std::max(0.0f, std::floor(a.x)), sightWidth - 1);
+        y0 = std::min((uint)std::max(0.0f, std::floor(a.y)), sightHeight - 1);
+        x1 = std::min((uint)std::max(0.0f, std::floor(b.x)), sightWidth - 1);
+        y1 = std::min((uint)std::max(0.0f, std::floor(b.y)), sightHeight - 1);
+    };
+
+    sightStart.assign(sightWidth * sightHeight + 1, 0);
+    uint x0, y0, x1, y1;
+    for (const auto& edge : sightEdges) {
+        cellRange(edge, x0, y0, x1, y1);
+        for (uint y = y0; y <= y1; y++) {
+            for (uint x = x0; x <= x1; x++) {
+                sightStart[y * sightWidth + x + 1]++;
+            }
+        }
+    }
+
+    for (uint c = 0; c < sightWidth * sightHeight; c++) {
+        sightStart[c + 1] += sightStart[c];
+    }
+
+    sightCells.resize(sightStart.back());
+    std::vector<uint> fill(sightStart.begin(), sightStart.end() - 1);
+    for (uint e = 0; e < sightEdges.size(); e++) {
+        cellRange(sightEdges[e], x0, y0, x1, y1);
+        for (uint y = y0; y <= y1; y++) {
+            for (uint x = x0; x <= x1; x++) {
+                sightCells[fill[y * sightWidth + x]++] = e;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Walks the grid cells the segment passes through (Amanatides-Woo traversal) testing their obstacle edges.
+ * @param nearest if false stops at the first edge crossed, otherwise keeps going until no later cell can hold a closer hit
+ * @param t output, fraction along the segment of the reported hit
+ * @param edge output, index into sightEdges of the reported hit
+ * @return whether the segment crosses any obstacle edge
+ */
+bool PaperMesh::traceObstacles(const vec2& start, const vec2& end, bool nearest, float& t, uint& edge) const {
+    if (sightEdges.empty()) {
+        return false;
+    }
+
+    // Clip the segment to the grid bounds
+    vec2 dir = end - start;
+    vec2 sightMax = sightMin + sightCellSize * vec2(sightWidth, sightHeight);
+    float tEnter = 0.0f;
+    float tExit = 1.0f;
+    for (int axis = 0; axis < 2; axis++) {
+        if (std::abs(dir[axis]) < EPSILON) {
+            if (start[axis] < sightMin[axis] || start[axis] > sightMax[axis]) return false;
             continue;
         }
-        
-        // Check if line segment intersects this obstacle polygon
-        if (lineSegmentIntersectsPolygon(start, end, uvRegion.positions)) {
-            return false; // Line of sight blocked
+
+        float ta = (sightMin[axis] - start[axis]) / dir[axis];
+        float tb = (sightMax[axis] - start[axis]) / dir[axis];
+        if (ta > tb) std::swap(ta, tb);
+        tEnter = std::max(tEnter, ta);
+        tExit = std::min(tExit, tb);
+    }
+
+    if (tEnter > tExit) {
+        return false; // Segment misses every obstacle
+    }
+
+    auto cellOf = [&](const vec2& pos, int& x, int& y) {
+        vec2 cell = (pos - sightMin) / sightCellSize;
+        x = std::clamp((int)std::floor(cell.x), 0, (int)sightWidth - 1);
+        y = std::clamp((int)std::floor(cell.y), 0, (int)sightHeight - 1);
+    };
+
+    int x, y, xEnd, yEnd;
+    cellOf(start + dir * tEnter, x, y);
+    cellOf(start + dir * tExit, xEnd, yEnd);
+
+    int stepX = dir.x > 0.0f ? 1 : -1;
+    int stepY = dir.y > 0.0f ? 1 : -1;
+    float inf = std::numeric_limits<float>::infinity();
+    float tMaxX = std::abs(dir.x) < EPSILON ? inf : (sightMin.x + (x + (stepX > 0)) * sightCellSize.x - start.x) / dir.x;
+    float tMaxY = std::abs(dir.y) < EPSILON ? inf : (sightMin.y + (y + (stepY > 0)) * sightCellSize.y - start.y) / dir.y;
+    float tDeltaX = std::abs(dir.x) < EPSILON ? inf : sightCellSize.x / std::abs(dir.x);
+    float tDeltaY = std::abs(dir.y) < EPSILON ? inf : sightCellSize.y / std::abs(dir.y);
+
+    // Edges spanning several cells may be tested more than once, cheaper than deduplicating
+    bool hit = false;
+    t = inf;
+    for (uint steps = 0; steps <= sightWidth + sightHeight; steps++) {
+        uint cell = y * sightWidth + x;
+        for (uint i = sightStart[cell]; i < sightStart[cell + 1]; i++) {
+            const auto& candidate = sightEdges[sightCells[i]];
+            float tEdge;
+            if (!lineSegmentsIntersect(start, end, candidate.first, candidate.second, tEdge) || tEdge >= t) continue;
+
+            hit = true;
+            t = tEdge;
+            edge = sightCells[i];
+            if (!nearest) return true;
+        }
+
+        // every later cell starts past the segment's exit from this one
+        if (hit && t <= std::min(tMaxX, tMaxY)) break;
+        if (x == xEnd && y == yEnd) break;
+
+        if (tMaxX < tMaxY) {
+            x += stepX;
+            tMaxX += tDeltaX;
+        } else {
+            y += stepY;
+            tMaxY += tDeltaY;
+        }
+
+        if (x < 0 || y < 0 || x >= (int)sightWidth || y >= (int)sightHeight) break;
+    }
+
+    return hit;
+}
+
+/**
+ * @brief Checks whether the segment crosses any obstacle edge, only visiting the grid cells the segment passes through
+ */
+bool PaperMesh::hasLineOfSight(const vec2& start, const vec2& end) const {
+    float t;
+    uint edge;
+    return !traceObstacles(start, end, false, t, edge);
+}
+
+/**
+ * @brief Finds the first obstacle edge crossed moving from start to end, for swept collision of fast moving objects
+ * @param t output, fraction of the move completed at the hit
+ * @param normal output, unit normal of the hit edge facing back against the move
+ */
+bool PaperMesh::sweepObstacles(const vec2& start, const vec2& end, float& t, vec2& normal) const {
+    uint edge;
+    if (!traceObstacles(start, end, true, t, edge)) return false;
+
+    vec2 along = sightEdges[edge].second - sightEdges[edge].first;
+    normal = glm::normalize(vec2(-along.y, along.x));
+    if (glm::dot(normal, end - start) > 0.0f) normal = -normal;
+    return true;
+}
+
+/**
+ * @brief Line of sight from every start to a shared end, e.g. all enemies on a side to the player.
+ * Every ray ends at the same point, so the obstacle edges are binned once by the arc of directions they cover
+ * as seen from end, nearest first. Each start then only tests the edges in its direction's bin that are closer than it.
+ * Small batches skip the setup and walk the grid per start.
+ * @param visible output, visible[i] is the result for starts[i]
+ */
+void PaperMesh::hasLineOfSight(std::span<const vec2> starts, const vec2& end, std::vector<bool>& visible) const {
+    visible.assign(starts.size(), true);
+    if (sightEdges.empty()) {
+        return;
+    }
+
+    const size_t MIN_BATCH = 4;
+    if (starts.size() < MIN_BATCH) {
+        for (size_t i = 0; i < starts.size(); i++) {
+            visible[i] = hasLineOfSight(starts[i], end);
+        }
+        return;
+    }
+
+    const int ARC_BINS = 64;
+    const float binScale = ARC_BINS / (2.0f * glm::pi<float>());
+    auto binOf = [&](const vec2& dir) {
+        int bin = (int)std::floor((std::atan2(dir.y, dir.x) + glm::pi<float>()) * binScale);
+        return std::clamp(bin, 0, ARC_BINS - 1);
+    };
+
+    // closest distance from end to every edge, edges are binned in this order so each bin is sorted nearest first
+    std::vector<std::pair<float, uint>> byDistance(sightEdges.size());
+    for (uint e = 0; e < sightEdges.size(); e++) {
+        const auto& [a, b] = sightEdges[e];
+        vec2 along = b - a;
+        float lengthSq = glm::dot(along, along);
+        float u = lengthSq < EPSILON ? 0.0f : std::clamp(glm::dot(end - a, along) / lengthSq, 0.0f, 1.0f);
+        byDistance[e] = { glm::length(a + along * u - end), e };
+    }
+    std::sort(byDistance.begin(), byDistance.end());
+
+    // Count then fill the bins each edge's arc spans, padded by a bin on each side against rounding at the bin edges
+    std::vector<uint> binStart(ARC_BINS + 1, 0);
+    std::vector<uint> binEdges;
+    std::vector<float> binDistances;
+    auto forEachBin = [&](uint e, auto&& visit) {
+        vec2 a = sightEdges[e].first - end;
+        vec2 b = sightEdges[e].second - end;
+        if (std::abs(cross(a, b)) < EPSILON) {
+            // edge lines up with end, its arc is a direction or the edge passes through end, so test it everywhere
+            for (int bin = 0; bin < ARC_BINS; bin++) visit(bin);
+            return;
+        }
+        if (cross(a, b) < 0.0f) std::swap(a, b);
+
+        // counter clockwise from a to b, always under half a turn
+        int first = binOf(a) - 1 + ARC_BINS;
+        int last = binOf(b) + 1 + ARC_BINS;
+        if (last < first) last += ARC_BINS;
+        for (int bin = first; bin <= last && bin - first < ARC_BINS; bin++) visit(bin % ARC_BINS);
+    };
+
+    for (const auto& [distance, e] : byDistance) {
+        forEachBin(e, [&](int bin) { binStart[bin + 1]++; });
+    }
+    for (int bin = 0; bin < ARC_BINS; bin++) {
+        binStart[bin + 1] += binStart[bin];
+    }
+    binEdges.resize(binStart.back());
+    binDistances.resize(binStart.back());
+    std::vector<uint> fill(binStart.begin(), binStart.end() - 1);
+    for (const auto& [distance, e] : byDistance) {
+        forEachBin(e, [&](int bin) {
+            binEdges[fill[bin]] = e;
+            binDistances[fill[bin]++] = distance;
+        });
+    }
+
+    for (size_t i = 0; i < starts.size(); i++) {
+        vec2 dir = starts[i] - end;
+        float length = glm::length(dir);
+        int bin = binOf(dir);
+        for (uint k = binStart[bin]; k < binStart[bin + 1] && binDistances[k] <= length; k++) {
+            const auto& candidate = sightEdges[binEdges[k]];
+            if (lineSegmentsIntersect(starts[i], end, candidate.first, candidate.second)) {
+                visible[i] = false;
+                break;
+            }
         }
     }
-    
-    return true; // No obstacles blocking the line
 }
 
 std::pair<vec2, vec2> PaperMesh::getOriginalAABB() const {
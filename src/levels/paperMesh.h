@@ -5,6 +5,8 @@
 #include "levels/edger.h"
 #include "levels/dymesh.h"
 #include "levels/navmesh.h"
+#include <memory>
+#include <span>
 
 class Game;
 
@@ -15,6 +17,16 @@ struct PaperMesh : public DyMesh {
     Mesh* mesh;
     std::vector<vec2> startingRegion;
     Navmesh* navmesh;
+    std::shared_ptr<const Navmesh> navmeshSnapshot; // immutable copy handed to path workers, replaced on regeneration
+
+    // uniform grid over obstacle edges for line of sight, cell c holds sightEdges[sightCells[sightStart[c], sightStart[c + 1])]
+    std::vector<std::pair<vec2, vec2>> sightEdges;
+    std::vector<uint> sightStart;
+    std::vector<uint> sightCells;
+    vec2 sightMin;
+    vec2 sightCellSize;
+    uint sightWidth = 0;
+    uint sightHeight = 0;
 
     PaperMesh(const std::vector<vec2> verts, Mesh* mesh);
     ~PaperMesh();
@@ -25,14 +37,41 @@ struct PaperMesh : public DyMesh {
     PaperMesh& operator=(const PaperMesh& other);
     PaperMesh& operator=(PaperMesh&& other) noexcept;
 
+    // Trial copy sharing other's polygons, without resources it has no GPU mesh or navmesh until it adopts them
+    PaperMesh(const PaperMesh& other, bool buildResources);
+    void adoptResources(PaperMesh& other); // takes other's GPU mesh and navmesh, to be patched by regenerateMesh / regenerateNavmesh
+
     void regenerateMesh();
     void regenerateNavmesh();
+    void regenerateNavmesh(const std::vector<std::pair<vec2, vec2>>& dirty); // incremental, dirty boxes bound every change since the last build
+
+    std::shared_ptr<const Navmesh> getNavmeshSnapshot() const { return navmeshSnapshot; }
+    uint getNavmeshVersion() const { return navmesh ? navmesh->getVersion() : 0; }
+    uint getLastPathExpansions() const { return navmesh ? navmesh->getLastExpansions() : 0; }
+    uint64_t getPathCacheHits() const { return navmesh ? navmesh->getCacheHits() : 0; }
+    uint64_t getPathCacheMisses() const { return navmesh ? navmesh->getCacheMisses() : 0; }
+    int locateTriangle(const vec2& pos) const { return navmesh ? navmesh->locate(pos) : -1; }
+    int getFlowGoal() const { return navmesh ? navmesh->getFlowGoal() : -1; }
 
     void getPath(std::vector<vec2>& path, vec2 start, vec2 dest, float padding = 0.0f) {
         if (navmesh) navmesh->getPath(path, start, dest, padding);
     }
 
+    void buildFlowField(const vec2& goal) {
+        if (navmesh) navmesh->buildFlowField(goal);
+    }
+
+    void clearFlowField() {
+        if (navmesh) navmesh->clearFlowField();
+    }
+
+    bool getFlowWaypoint(const vec2& pos, const vec2& dest, vec2& waypoint, float padding = 0.0f) const {
+        return navmesh && navmesh->getFlowWaypoint(pos, dest, waypoint, padding);
+    }
+
     bool hasLineOfSight(const vec2& start, const vec2& end) const;
+    void hasLineOfSight(std::span<const vec2> starts, const vec2& end, std::vector<bool>& visible) const; // every start against one end
+    bool sweepObstacles(const vec2& start, const vec2& end, float& t, vec2& normal) const; // first obstacle edge crossed by the move
 
     std::pair<vec2, vec2> getOriginalAABB() const;
     std::pair<vec2, vec2> getAABB() const;
@@ -42,6 +81,11 @@ struct PaperMesh : public DyMesh {
 
     // Select a random position that is not in any UVregion marked as isObstacle
     vec2 getRandomNonObstaclePosition(int maxAttempts = 1000) const;
+
+private:
+    void addNavmeshRings();
+    void buildSightGrid();
+    bool traceObstacles(const vec2& start, const vec2& end, bool nearest, float& t, uint& edge) const;
 };
 
 #endif
\ No newline at end of file
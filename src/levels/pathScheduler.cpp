@@ -0,0 +1,54 @@
+#include "levels/pathScheduler.h"
+#include <chrono>
+
+/**
+ * @brief Queues an enemy for this frame's refresh pass
+ * @param age seconds since the enemy's path was last refreshed
+ * @param distance distance from the enemy to the player
+ * @param targetChanged whether the target left the triangle the current path was planned toward
+ */
+void PathScheduler::add(Enemy* enemy, float age, float distance, bool targetChanged) {
+    float priority = weights.staleness * age 
+                   + weights.proximity / (1.0f + distance) 
+                   + (targetChanged ? weights.targetChanged : 0.0f);
+    candidates.push_back({ enemy, priority, age });
+}
+
+/**
+ * @brief Refreshes queued enemies from highest to lowest priority until one of the budgets is spent. 
+ * Enemies left over keep their current path and age into a higher priority next frame.
+ */
+void PathScheduler::run(const std::function<Cost(Enemy*)>& refresh) {
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point startTime = Clock::now();
+
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        return a.priority > b.priority;
+    });
+
+    frame = Counters();
+    uint i = 0;
+    for (; i < candidates.size(); i++) {
+        if (i > 0) {
+            float elapsed = std::chrono::duration<float, std::micro>(Clock::now() - startTime).count();
+            if (frame.expansions >= budget.maxExpansions || frame.requests >= budget.maxRequests || elapsed >= budget.maxMicroseconds) {
+                break;
+            }
+        }
+
+        Cost cost = refresh(candidates[i].enemy);
+        frame.expansions += cost.expansions;
+        frame.requests += cost.requests;
+        frame.refreshed++;
+    }
+
+    frame.deferred = candidates.size() - i;
+    for (; i < candidates.size(); i++) {
+        frame.oldestPath = std::max(frame.oldestPath, candidates[i].age);
+    }
+    frame.microseconds = std::chrono::duration<float, std::micro>(Clock::now() - startTime).count();
+
+    totalRefreshed += frame.refreshed;
+    totalDeferred += frame.deferred;
+    candidates.clear();
+}
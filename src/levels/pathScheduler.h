@@ -0,0 +1,74 @@
+#ifndef PATH_SCHEDULER_H
+#define PATH_SCHEDULER_H
+
+#include "util/includes.h"
+
+class Enemy;
+
+/**
+ * @brief Spreads enemy path refreshes across frames under a fixed per-frame budget. Every frame the enemies whose 
+ * path is older than Budget::minInterval or whose target moved are ranked by how stale their path is, how close they are to the player, and whether their target moved to another 
+ * navmesh triangle, then refreshed in that order until the budget runs out. The rest wait for the next frame.
+ */
+class PathScheduler {
+public:
+    // Work done by a single refresh
+    struct Cost {
+        uint expansions = 0; // A* triangles closed on the main thread
+        uint requests = 0;   // searches handed to PathWorkers
+    };
+
+    // Per frame limits, at least one enemy is refreshed every frame regardless
+    struct Budget {
+        uint maxExpansions = 2000;
+        float maxMicroseconds = 1000.0f;
+        uint maxRequests = 8;
+        float minInterval = 0.2f; // seconds a path is kept before it is queued again, unless its target moved
+    };
+
+    // Priority weights
+    struct Weights {
+        float staleness = 1.0f;     // per second since the last refresh
+        float proximity = 4.0f;     // scaled by 1 / (1 + distance to player)
+        float targetChanged = 2.0f; // target is in a different triangle than when last planned
+    };
+
+    struct Counters {
+        uint refreshed = 0;
+        uint deferred = 0;
+        uint expansions = 0;
+        uint requests = 0;
+        float microseconds = 0.0f;
+        float oldestPath = 0.0f; // staleness of the oldest path left after the frame
+    };
+
+    struct Candidate {
+        Enemy* enemy;
+        float priority;
+        float age;
+    };
+
+private:
+    Budget budget;
+    Weights weights;
+    Counters frame;      // last frame
+    uint64_t totalRefreshed = 0;
+    uint64_t totalDeferred = 0;
+
+    std::vector<Candidate> candidates;
+
+public:
+    PathScheduler() = default;
+
+    Budget& getBudget() { return budget; }
+    Weights& getWeights() { return weights; }
+    const Counters& getCounters() const { return frame; }
+    uint64_t getTotalRefreshed() const { return totalRefreshed; }
+    uint64_t getTotalDeferred() const { return totalDeferred; }
+
+    void clear() { candidates.clear(); }
+    void add(Enemy* enemy, float age, float distance, bool targetChanged);
+    void run(const std::function<Cost(Enemy*)>& refresh);
+};
+
+#endif
@@ -0,0 +1,92 @@
+#include "levels/pathWorkers.h"
+
+PathWorkers& PathWorkers::get() {
+    static PathWorkers instance;
+    return instance;
+}
+
+/**
+ * @brief Queues a path search on the workers
+ * @param supersedes a previous request from the same agent, cancelled since its result would be overwritten anyway
+ * @return handle to poll for the result
+ */
+PathWorkers::Handle PathWorkers::request(std::shared_ptr<const Navmesh> navmesh, const vec2& start, const vec2& dest, float padding, Handle supersedes) {
+    if (!navmesh) {
+        return 0;
+    }
+
+    Handle handle;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        requests.erase(supersedes);
+        handle = nextHandle++;
+        requests.emplace(handle, Result());
+    }
+
+    pool.submit([this, handle, navmesh = std::move(navmesh), start, dest, padding]() {
+        // Skip requests cancelled while they were queued
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (requests.find(handle) == requests.end()) {
+                return;
+            }
+        }
+
+        // Each worker keeps its own scratch so searches never allocate once warmed up
+        thread_local Navmesh::SearchContext ctx;
+        std::vector<vec2> path;
+        uint64_t hits = ctx.cacheHits;
+        uint64_t misses = ctx.cacheMisses;
+        navmesh->getPath(path, start, dest, padding, ctx);
+        cacheHits += ctx.cacheHits - hits;
+        cacheMisses += ctx.cacheMisses - misses;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = requests.find(handle);
+        if (it == requests.end()) {
+            return;
+        }
+
+        it->second.ready = true;
+        it->second.version = navmesh->getVersion();
+        it->second.path = std::move(path);
+    });
+
+    return handle;
+}
+
+void PathWorkers::cancel(Handle handle) {
+    if (handle == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    requests.erase(handle);
+}
+
+/**
+ * @brief Collects the result of a request if it has finished
+ * @param version version of the navmesh the agent is on now, results planned on any other version are dropped
+ * @param path output, only written when READY is returned
+ */
+PathWorkers::Status PathWorkers::poll(Handle handle, uint version, std::vector<vec2>& path) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = requests.find(handle);
+    if (it == requests.end()) {
+        return Status::DROPPED;
+    }
+
+    if (!it->second.ready) {
+        return Status::PENDING;
+    }
+
+    Status status = Status::DROPPED;
+    if (it->second.version == version) {
+        path = std::move(it->second.path);
+        status = Status::READY;
+    }
+
+    requests.erase(it);
+    return status;
+}
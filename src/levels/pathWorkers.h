@@ -0,0 +1,59 @@
+#ifndef PATH_WORKERS_H
+#define PATH_WORKERS_H
+
+#include "util/includes.h"
+#include "util/threadPool.h"
+#include "levels/navmesh.h"
+#include <memory>
+#include <atomic>
+
+/**
+ * @brief Answers path requests on a worker thread pool. Requests search an immutable navmesh snapshot and their 
+ * results are collected on a later frame with poll(). Results are tagged with the navmesh version they were 
+ * computed on so a path planned before a fold is never delivered after it.
+ */
+class PathWorkers {
+public:
+    using Handle = uint64_t; // 0 is never a valid request
+
+    enum class Status {
+        PENDING, // still queued or being searched
+        READY,   // path was written out, the handle is spent
+        DROPPED  // cancelled, unknown, or planned on another navmesh version
+    };
+
+private:
+    struct Result {
+        bool ready = false;
+        uint version = 0;
+        std::vector<vec2> path;
+    };
+
+    std::mutex mutex;
+    std::unordered_map<Handle, Result> requests;
+    Handle nextHandle = 1;
+
+    // path cache effectiveness summed over every worker's context
+    std::atomic<uint64_t> cacheHits = 0;
+    std::atomic<uint64_t> cacheMisses = 0;
+
+    // declared last so the workers are joined before the state they touch is destroyed
+    ThreadPool pool;
+
+    PathWorkers() = default;
+
+public:
+    static PathWorkers& get();
+
+    PathWorkers(const PathWorkers&) = delete;
+    PathWorkers& operator=(const PathWorkers&) = delete;
+
+    Handle request(std::shared_ptr<const Navmesh> navmesh, const vec2& start, const vec2& dest, float padding = 0.0f, Handle supersedes = 0);
+    void cancel(Handle handle);
+    Status poll(Handle handle, uint version, std::vector<vec2>& path);
+
+    uint64_t getCacheHits() const { return cacheHits; }
+    uint64_t getCacheMisses() const { return cacheMisses; }
+};
+
+#endif
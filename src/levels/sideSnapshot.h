@@ -0,0 +1,23 @@
+#ifndef SIDE_SNAPSHOT_H
+#define SIDE_SNAPSHOT_H
+
+#include "util/includes.h"
+
+struct PaperMesh;
+
+/**
+ * @brief Per frame facts about a side that every enemy on it needs, gathered once in SingleSide::update
+ * so enemy status and behaviors read them instead of rescanning the side. Per enemy entries are indexed like SingleSide::getEnemies()
+ */
+struct SideSnapshot {
+    vec2 playerPos = vec2(0.0f);
+    int playerTriangle = -1; // navmesh triangle under the player, -1 when off the mesh or there is no mesh
+    PaperMesh* paperMesh = nullptr; // mesh of this side, null if the side is not on the current paper
+    uint aliveEnemies = 0;
+
+    std::vector<vec2> enemyPositions;
+    std::vector<float> playerDistances;
+    std::vector<bool> lineOfSight; // from each enemy to the player, one batched query
+};
+
+#endif
@@ -10,6 +10,7 @@
 
 
 SingleSide::SingleSide(Game* game, std::string mesh, std::string material, vec2 playerSpawn, std::string biome, std::vector<vec2> enemySpawns, float difficulty) : 
+    game(game),
     scene(nullptr), 
     camera(nullptr), 
     background(nullptr), 
@@ -83,7 +84,7 @@ SingleSide::SingleSide(Game* game, std::string mesh, std::string material, vec2
 }
 
 SingleSide::SingleSide(const SingleSide& other) noexcept 
-    : scene(nullptr), camera(nullptr), background(nullptr), playerNode(nullptr), weaponNode(nullptr)
+    : game(other.game), scene(nullptr), camera(nullptr), background(nullptr), playerNode(nullptr), weaponNode(nullptr)
 {
     if (other.scene) scene = new Scene2D(*other.scene);
     if (other.camera) camera = new StaticCamera2D(*other.camera);
@@ -146,10 +147,13 @@ SingleSide::SingleSide(const SingleSide& other) noexcept
 }
 
 SingleSide::SingleSide(SingleSide&& other) noexcept : 
+    game(other.game),
     scene(other.scene),
     camera(other.camera),
     enemies(std::move(other.enemies)),
     damageZones(std::move(other.damageZones)), 
+    zonePool(std::move(other.zonePool)),
+    projectiles(std::move(other.projectiles)),
     background(nullptr),
     playerNode(nullptr),
     playerSpawn(other.playerSpawn),
@@ -178,6 +182,7 @@ SingleSide& SingleSide::operator=(const SingleSide& other) noexcept {
     if (other.scene) scene = new Scene2D(*other.scene);
     if (other.camera) camera = new StaticCamera2D(*other.camera);
 
+    game = other.game;
     enemies = other.enemies;
     damageZones = other.damageZones;
     playerSpawn = other.playerSpawn;
@@ -191,10 +196,13 @@ SingleSide& SingleSide::operator=(SingleSide&& other) noexcept {
     clear();
 
     // transfer
+    game = other.game;
     scene = other.scene;
     camera = other.camera;
     enemies = std::move(other.enemies);
     damageZones = std::move(other.damageZones);
+    zonePool = std::move(other.zonePool);
+    projectiles = std::move(other.projectiles);
     pickups = std::move(other.pickups);
     playerSpawn = other.playerSpawn;
     enemySpawns = other.enemySpawns;
@@ -206,74 +214,93 @@ SingleSide& SingleSide::operator=(SingleSide&& other) noexcept {
     return *this;
 }
 
+/**
+ * @brief Gets the paper mesh this side is drawn on, or null if the side is not part of the current paper
+ */
+PaperMesh* SingleSide::getPaperMesh() const {
+    Paper* paper = game ? game->getPaper() : nullptr;
+    if (paper == nullptr) return nullptr;
+
+    if (this == paper->getFirstSide()) return paper->paperMeshes.first;
+    if (this == paper->getSecondSide()) return paper->paperMeshes.second;
+    return nullptr;
+}
+
 void SingleSide::generateNavmesh() {
     
 }
 
 void SingleSide::update(const vec2& playerPos, float dt, Player* player) {
+    simulate(playerPos, dt, player);
+    sync();
+}
+
+/**
+ * @brief Advances everything that belongs to this side alone. Anything reaching outside the side (boss hits, sound)
+ * is queued until sync(), so the two sides of a paper can simulate on different threads. Nodes are only created and
+ * deleted in sync() too, see deferToSync
+ */
+void SingleSide::simulate(const vec2& playerPos, float dt, Player* player) {
+    simulating = true;
+
+    // move all pooled projectiles in one batch, their zones report the result in the loop below
+    projectiles.update(dt, getPaperMesh());
+
     // update all damageZones
     // done before enemy update to give a "summoning sickness" for a single frame
-    for (int i = 0; i < damageZones.size(); i++) {
-        DamageZone* zone = damageZones[i];
-
-        bool good = zone->update(dt);
-        if (good == false) {
-            delete zone; zone = nullptr;
-            damageZones.erase(damageZones.begin() + i--);
-            continue;
-        }
+    for (uint i = 0; i < damageZones.size(); i++) {
+        if (damageZones[i]->update(dt) == false) retireZone(i);
     }
 
     // Check for collisions between player damage zones and enemy damage zones
     // This happens before character collision checks
-    for (int i = 0; i < damageZones.size(); i++) {
+    zoneHash.clear();
+    for (uint i = 0; i < damageZones.size(); i++) {
+        DamageZone* zone = damageZones[i];
+        if (!zone) continue;
+        zoneHash.insert(zone->getPosition(), zone->getRadius(), zone->getOwner()->getTeamLayer(), i);
+    }
+    zoneHash.build();
+
+    for (uint i = 0; i < damageZones.size(); i++) {
         DamageZone* playerZone = damageZones[i];
-        if (!playerZone || playerZone->getOwner()->getTeam() != "Ally") continue;
+        if (!playerZone || !(playerZone->getOwner()->getTeamLayer() & TEAM_ALLY)) continue;
 
-        for (int j = 0; j < damageZones.size(); j++) {
-            DamageZone* enemyZone = damageZones[j];
-            if (!enemyZone || enemyZone->getOwner()->getTeam() != "Enemy") continue;
-            if (i == j) continue; // Don't check a zone against itself
+        zoneHash.query(playerZone->getPosition(), playerZone->getRadius(), TEAM_ENEMY, [&](uint j) {
+            if (!damageZones[j]) return; // already removed by another player zone
 
-            // Check collision between the two zones
-            float combinedRadius = playerZone->getRadius() + enemyZone->getRadius();
-            float distSq = glm::length2(playerZone->getPosition() - enemyZone->getPosition());
-            
-            if (distSq <= combinedRadius * combinedRadius) {
-                // Player zone hit enemy zone - remove enemy zone and play sound
-                Character* enemyOwner = enemyZone->getOwner();
-                std::string damageSound = enemyOwner->getDamageSound();
-                
-                if (!damageSound.empty()) {
-                    audio::SFXPlayer::Get().Play(damageSound);
-                }
-                
-                // Remove the enemy zone
-                delete enemyZone; enemyZone = nullptr;
-                damageZones.erase(damageZones.begin() + j);
-                
-                // Adjust indices since we removed an element
-                if (j < i) i--;
-                j--; // Decrement j to account for removed element
+            // Player zone hit enemy zone - remove enemy zone and play sound
+            std::string damageSound = damageZones[j]->getOwner()->getDamageSound();
+            if (!damageSound.empty()) {
+                audio::SFXPlayer::Get().Play(damageSound);
             }
-        }
+
+            retireZone(j);
+        });
     }
 
     // Now check collisions with characters
+    enemyHash.clear();
+    for (uint j = 0; j < enemies.size(); j++) {
+        Enemy* enemy = enemies[j];
+        if (enemy->isDead()) continue;
+        enemyHash.insert(enemy->getPosition(), enemy->getRadius(), enemy->getTeamLayer(), j);
+    }
+    enemyHash.build();
+
     for (int i = 0; i < damageZones.size(); i++) {
         DamageZone* zone = damageZones[i];
+        if (!zone) continue;
 
-        // check collision with enemies
-        for (int j = 0; j < enemies.size(); j++) {
+        // check collision with enemies on layers this zone can damage
+        enemyHash.query(zone->getPosition(), zone->getRadius(), zone->getHitMask(), [&](uint j) {
             Enemy* enemy = enemies[j];
-            if (enemy->isDead()) continue; // Skip already dead enemies
-            float combinedRadius = enemy->getRadius() + zone->getRadius();
-            if (glm::length2(enemy->getPosition() - zone->getPosition()) > combinedRadius * combinedRadius) continue;
+            if (enemy->isDead()) return; // Skip enemies killed earlier this frame
             zone->hit(enemy);
-        }
+        });
 
         // check collision with player (if player exists and is on this side)
-        if (player != nullptr && !player->isDead()) {
+        if (player != nullptr && !player->isDead() && (zone->getHitMask() & player->getTeamLayer())) {
             float combinedRadius = player->getRadius() + zone->getRadius();
             float distSq = glm::length2(player->getPosition() - zone->getPosition());
             if (distSq <= combinedRadius * combinedRadius) {
@@ -289,7 +316,7 @@ void SingleSide::update(const vec2& playerPos, float dt, Player* player) {
                 bool isFriendly = zone->getFriendlyDamage();
                 // Boss is immune to damage zones from Enemy team
                 Character* zoneOwner = zone->getOwner();
-                bool isEnemyTeam = (zoneOwner != nullptr && zoneOwner->getTeam() == "Enemy");
+                bool isEnemyTeam = (zoneOwner != nullptr && (zoneOwner->getTeamLayer() & TEAM_ENEMY));
                 
                 static int bossCheckCount = 0;
                 bossCheckCount++;
@@ -317,8 +344,8 @@ void SingleSide::update(const vec2& playerPos, float dt, Player* player) {
                     
                     if (distSq <= combinedRadius * combinedRadius) {
                         std::cout << "[SingleSide::update] BOSS HIT! Calling onDamage with " << zone->getDamage() << " damage" << std::endl;
-                        // Boss takes damage from non-friendly damage zones (excluding Enemy team)
-                        boss->onDamage(zone->getDamage());
+                        // Boss takes damage from non-friendly damage zones (excluding Enemy team), applied in sync()
+                        bossHits.push_back(zone->getDamage());
                     }
                 }
             }
@@ -331,24 +358,25 @@ void SingleSide::update(const vec2& playerPos, float dt, Player* player) {
         if (enemy->isDead() == false) continue;
 
         // Remove all damage zones owned by this enemy before deleting it
-        for (int j = 0; j < damageZones.size(); j++) {
-            if (damageZones[j]->getOwner() == enemy) {
-                delete damageZones[j];
-                damageZones.erase(damageZones.begin() + j);
-                j--;
-            }
+        for (uint j = 0; j < damageZones.size(); j++) {
+            if (damageZones[j] && damageZones[j]->getOwner() == enemy) retireZone(j);
         }
 
         enemy->onDeath();
         enemies.erase(enemies.begin() + i);
-        delete enemy;
+        deferToSync([enemy]() { delete enemy; });
         i--;
     }
 
-    // update all enemies
-    for (Enemy* enemy : enemies) {
-        enemy->updateStatus(playerPos);
-        enemy->move(playerPos, dt);
+    // everything retired this frame leaves the list in one pass
+    compactZones();
+
+    // update all enemies from one shared snapshot of the side
+    buildSnapshot(playerPos);
+    for (uint i = 0; i < enemies.size(); i++) {
+        Enemy* enemy = enemies[i];
+        enemy->updateStatus(snapshot, i);
+        enemy->move(snapshot, dt);
     }
 
     // update all pickups
@@ -380,10 +408,49 @@ void SingleSide::update(const vec2& playerPos, float dt, Player* player) {
         }
     }
 
+    simulating = false;
+}
+
+/**
+ * @brief Applies what simulate() queued for the rest of the game and steps the scene. Must run on the main thread
+ * with no side simulating, this is the only point where cross side state is touched
+ */
+void SingleSide::sync() {
+    Boss* boss = game ? game->getBoss() : nullptr;
+    if (boss != nullptr) {
+        for (int damage : bossHits) {
+            boss->onDamage(damage);
+        }
+    }
+    bossHits.clear();
+
+    for (auto& work : nodeWork) {
+        work();
+    }
+    nodeWork.clear();
+
+    // once the projectile batch has let go of every parked zone, parked zones over the cap can be deleted
+    projectiles.dropRetired();
+    zonePool.trim();
+
     scene->update();
 }
 
+/**
+ * @brief Runs work now, or queues it for sync() when called from simulate(). Creating and deleting Basilisk nodes 
+ * is only known to be safe on the main thread, and simulate() may run on a side worker
+ */
+void SingleSide::deferToSync(std::function<void()> work) {
+    if (simulating) nodeWork.push_back(std::move(work));
+    else work();
+}
+
 void SingleSide::clear() {
+    for (auto& work : nodeWork) {
+        work();
+    }
+    nodeWork.clear();
+
     for (Enemy* enemy : enemies) {
         delete enemy;
     }
@@ -395,11 +462,68 @@ void SingleSide::clear() {
     pickups.clear();
     
     walls.clear(); // will get cleaned by the scene
+    damageZones.clear(); // same for active and parked zones
+    zonePool.clear();
+    projectiles.clear();
 
     delete scene; scene = nullptr;
     delete camera; camera = nullptr;
 }
 
+/**
+ * @brief Gathers what every enemy's status and behavior needs this frame: the alive count, player distances,
+ * and line of sight from every enemy to the player in one pass over the obstacle grid
+ */
+void SingleSide::buildSnapshot(const vec2& playerPos) {
+    snapshot.playerPos = playerPos;
+    snapshot.paperMesh = getPaperMesh();
+    snapshot.playerTriangle = snapshot.paperMesh ? snapshot.paperMesh->locateTriangle(playerPos) : -1;
+
+    snapshot.aliveEnemies = 0;
+    snapshot.enemyPositions.clear();
+    snapshot.playerDistances.clear();
+    for (Enemy* enemy : enemies) {
+        if (!enemy->isDead()) snapshot.aliveEnemies++;
+
+        vec2 pos = enemy->getPosition();
+        snapshot.enemyPositions.push_back(pos);
+        snapshot.playerDistances.push_back(glm::length(playerPos - pos));
+    }
+
+    // no mesh means no line of sight, same as Character::hasLineOfSight
+    if (snapshot.paperMesh != nullptr) {
+        snapshot.paperMesh->hasLineOfSight(snapshot.enemyPositions, playerPos, snapshot.lineOfSight);
+    } else {
+        snapshot.lineOfSight.assign(enemies.size(), false);
+    }
+}
+
+/**
+ * @brief Returns a zone to the pool and leaves a hole in damageZones, so indices held during update stay valid
+ */
+void SingleSide::retireZone(uint index) {
+    DamageZone* zone = damageZones[index];
+    damageZones[index] = nullptr;
+
+    // parking only hides the node, zones that cannot be parked are deleted
+    if (zone->isPoolable()) zonePool.release(zone);
+    else deferToSync([this, zone]() { zonePool.release(zone); });
+}
+
+/**
+ * @brief Removes the holes left by retireZone by swapping the last zone into each one. Zone order is not preserved
+ */
+void SingleSide::compactZones() {
+    for (uint i = 0; i < damageZones.size();) {
+        if (damageZones[i]) {
+            i++;
+            continue;
+        }
+        damageZones[i] = damageZones.back();
+        damageZones.pop_back();
+    }
+}
+
 void SingleSide::clearWalls() {
     for (auto& wall : walls) {
         delete wall;
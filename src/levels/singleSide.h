@@ -2,12 +2,17 @@
 #define SINGLE_SIDE_H
 
 #include "util/includes.h"
+#include "util/spatialHash.h"
+#include "weapon/zonePool.h"
+#include "weapon/projectileSystem.h"
+#include "levels/sideSnapshot.h"
 
 class Enemy;
 class Game;
 class DamageZone;
 class Player;
 class Pickup;
+struct PaperMesh;
 
 class SingleSide {  
 public:
@@ -18,12 +23,23 @@ public:
     std::unordered_map<std::string, Collider*> colliders;
 
 private:
+    Game* game;
     Scene2D* scene;
     StaticCamera2D* camera;
     std::vector<Enemy*> enemies;
-    std::vector<DamageZone*> damageZones;
+    std::vector<DamageZone*> damageZones; // retired zones are nulled during update and compacted at the end
+    ZonePool zonePool;
+    ProjectileSystem projectiles;
+    SideSnapshot snapshot; // rebuilt in update before the enemies move
+    std::vector<int> bossHits; // damage dealt to the boss during simulate, applied in sync
+    std::vector<std::function<void()>> nodeWork; // node creation and deletion queued during simulate, run in sync
+    bool simulating = false;
     std::vector<Pickup*> pickups;
 
+    // per frame broadphase, rebuilt in update
+    SpatialHash zoneHash;
+    SpatialHash enemyHash;
+
     Node2D* background;
     Node2D* playerNode;
     Node2D* weaponNode;
@@ -50,7 +66,14 @@ public:
     Scene2D* getScene() { return scene; }
     auto& getEnemies() { return enemies; }
     auto& getPickups() { return pickups; }
-    Collider* getCollider(std::string name) { return colliders[name]; }
+    ZonePool& getZonePool() { return zonePool; }
+    ProjectileSystem& getProjectiles() { return projectiles; }
+    const SideSnapshot& getSnapshot() const { return snapshot; }
+    PaperMesh* getPaperMesh() const;
+    Collider* getCollider(const std::string& name) const {
+        auto it = colliders.find(name);
+        return it != colliders.end() ? it->second : nullptr;
+    }
     Node2D* getBackground() { return background; }
     Node2D* getPlayerNode() { return playerNode; }
     Node2D* getWeaponNode() { return weaponNode; }
@@ -67,14 +90,21 @@ public:
     std::string getBiome() const { return biome; }
 
     void generateNavmesh();
-    void update(const vec2& playerPos, float dt, Player* player = nullptr);
+    void update(const vec2& playerPos, float dt, Player* player = nullptr); // simulate then sync
+    void simulate(const vec2& playerPos, float dt, Player* player = nullptr);
+    void sync();
+    void deferToSync(std::function<void()> work); // anything that creates or deletes a Basilisk node
     void clearWalls();
     void loadResources();
+    // cross side moves, only between updates (never while either side is in simulate)
     void adoptEnemy(Enemy* enemy, SingleSide* fromSide);
     Pickup* adoptPickup(Pickup* pickup, SingleSide* fromSide);  // Returns the new pickup instance
 
 private:
     void clear();
+    void buildSnapshot(const vec2& playerPos);
+    void retireZone(uint index);
+    void compactZones();
 };
 
 #endif
\ No newline at end of file
@@ -1,4 +1,10 @@
 #include "levels/uvregion.h"
+#include <earcut.hpp>
+#include <cstring>
+#include "util/scratch.h"
+#if SIMD_GEOMETRY
+#include <emmintrin.h>
+#endif
 
 UVRegion::UVRegion(const std::vector<vec2>& positions, const std::array<Vert, 2>& basis, const vec2& originUV, bool isObstacle) 
     : positions(positions), basis(basis), originUV(originUV), isObstacle(isObstacle) {
@@ -99,7 +105,8 @@ bool UVRegion::contains(const vec2& p, float eps) const {
     size_t n = positions.size();
     if (n < 3) return false;
 
-    // Check if point is on boundary (within epsilon)
+    // Check if point is on boundary (within epsilon), the clamped projection is never farther than either end
+    float eps2 = eps * eps;
     for (size_t i = 0; i < n; ++i) {
         const vec2& a = positions[i];
         const vec2& b = positions[(i + 1) % n];
@@ -107,11 +114,9 @@ bool UVRegion::contains(const vec2& p, float eps) const {
         vec2 ab = b - a;
         float abLen2 = glm::dot(ab, ab);
         float t = glm::clamp(glm::dot(p - a, ab) / (abLen2 + 1e-20f), 0.0f, 1.0f);
-        vec2 proj = a + t * ab;
+        vec2 off = (p - a) - t * ab;
         
-        if (glm::length(p - proj) <= eps) return true;
-        if (glm::length(p - a) <= eps) return true;
-        if (glm::length(p - b) <= eps) return true;
+        if (glm::dot(off, off) <= eps2) return true;
     }
 
     // Standard even-odd raycast test
@@ -128,6 +133,86 @@ bool UVRegion::contains(const vec2& p, float eps) const {
     return inside;
 }
 
+/**
+ * @brief contains() for many points at once. With SIMD_GEOMETRY four points go through every edge together, 
+ * reading the edges from structure of arrays copies, leftover points use the scalar test.
+ */
+void UVRegion::containsMany(std::span<const vec2> points, std::span<uint8_t> out, float eps) const {
+    size_t count = std::min(points.size(), out.size());
+    size_t n = positions.size();
+    if (n < 3) {
+        std::fill(out.begin(), out.begin() + count, 0);
+        return;
+    }
+
+    size_t i = 0;
+
+#if SIMD_GEOMETRY
+    if (count >= 4) {
+        // Edge k runs from vertex k to vertex k + 1, copied into this thread's scratch arena
+        ScratchScope scratch;
+        std::pmr::vector<float> edges(4 * n, scratch.resource());
+        float* sx = edges.data();
+        float* sy = sx + n;
+        float* ex = sy + n;
+        float* ey = ex + n;
+        for (size_t k = 0; k < n; ++k) {
+            const vec2& s = positions[k];
+            const vec2& e = positions[(k + 1) % n];
+            sx[k] = s.x; sy[k] = s.y;
+            ex[k] = e.x; ey[k] = e.y;
+        }
+
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 eps2 = _mm_set1_ps(eps * eps);
+        const __m128 lenBias = _mm_set1_ps(1e-20f);
+        const __m128 slopeBias = _mm_set1_ps(1e-12f);
+
+        for (; i + 4 <= count; i += 4) {
+            __m128 px = _mm_set_ps(points[i + 3].x, points[i + 2].x, points[i + 1].x, points[i].x);
+            __m128 py = _mm_set_ps(points[i + 3].y, points[i + 2].y, points[i + 1].y, points[i].y);
+            __m128 onEdge = zero;
+            __m128 inside = zero;
+
+            for (size_t k = 0; k < n; ++k) {
+                __m128 ax = _mm_set1_ps(sx[k]);
+                __m128 ay = _mm_set1_ps(sy[k]);
+                __m128 bx = _mm_set1_ps(ex[k]);
+                __m128 by = _mm_set1_ps(ey[k]);
+
+                // squared distance to the clamped projection on the edge
+                __m128 abx = _mm_sub_ps(bx, ax);
+                __m128 aby = _mm_sub_ps(by, ay);
+                __m128 dx = _mm_sub_ps(px, ax);
+                __m128 dy = _mm_sub_ps(py, ay);
+                __m128 abLen2 = _mm_add_ps(_mm_mul_ps(abx, abx), _mm_mul_ps(aby, aby));
+                __m128 t = _mm_div_ps(_mm_add_ps(_mm_mul_ps(dx, abx), _mm_mul_ps(dy, aby)), _mm_add_ps(abLen2, lenBias));
+                t = _mm_min_ps(_mm_max_ps(t, zero), one);
+                __m128 offx = _mm_sub_ps(dx, _mm_mul_ps(t, abx));
+                __m128 offy = _mm_sub_ps(dy, _mm_mul_ps(t, aby));
+                __m128 dist2 = _mm_add_ps(_mm_mul_ps(offx, offx), _mm_mul_ps(offy, offy));
+                onEdge = _mm_or_ps(onEdge, _mm_cmple_ps(dist2, eps2));
+
+                // even-odd crossing, same form as the scalar test with its a and b being this edge's end and start
+                __m128 straddles = _mm_xor_ps(_mm_cmpgt_ps(by, py), _mm_cmpgt_ps(ay, py));
+                __m128 crossX = _mm_add_ps(_mm_div_ps(_mm_mul_ps(_mm_sub_ps(ax, bx), _mm_sub_ps(py, by)), _mm_add_ps(_mm_sub_ps(ay, by), slopeBias)), bx);
+                inside = _mm_xor_ps(inside, _mm_and_ps(straddles, _mm_cmplt_ps(px, crossX)));
+            }
+
+            int mask = _mm_movemask_ps(_mm_or_ps(onEdge, inside));
+            for (int l = 0; l < 4; ++l) {
+                out[i + l] = (mask >> l) & 1;
+            }
+        }
+    }
+#endif
+
+    for (; i < count; ++i) {
+        out[i] = contains(points[i], eps);
+    }
+}
+
 float UVRegion::distance(const vec2& pos) const {
     if (contains(pos, 0.0f)) return 0.0f;
     
@@ -177,6 +262,20 @@ vec2 UVRegion::sampleUV(const vec2& pos) const {
     return originUV + a * basis[0].uv + b * basis[1].uv;
 }
 
+/**
+ * @brief Writes the mapping sampleUV applies as uv = m * pos + c, so regions can be compared independent of their basis
+ */
+bool UVRegion::uvMap(mat2x2& m, vec2& c) const {
+    if (positions.empty()) return false;
+
+    mat2x2 dirs(basis[0].pos, basis[1].pos);
+    if (std::abs(glm::determinant(dirs)) < 1e-12f) return false;
+
+    m = mat2x2(basis[0].uv, basis[1].uv) * glm::inverse(dirs);
+    c = originUV - m * positions[0];
+    return true;
+}
+
 void UVRegion::flipUVx() {
     // Negate the x component of origin and both basis UVs
     originUV.x = -originUV.x;
@@ -185,10 +284,92 @@ void UVRegion::flipUVx() {
 }
 
 void UVRegion::flipHorizontal() {
-    for (vec2& p : positions) {
+    for (vec2& p : positions.edit()) {
         p.x *= -1.0f;
     }
     // Also flip the basis positions
     basis[0].pos.x *= -1.0f;
     basis[1].pos.x *= -1.0f;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief FNV-1a over the raw float bits of everything the triangulation depends on. The positions part is cached 
+ * against positions.stamp(), so unchanged regions only rehash the basis and origin UV on each export
+ */
+uint64_t UVRegion::contentVersion() const {
+    uint64_t hash;
+    auto mix = [&](float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        hash = (hash ^ bits) * 1099511628211ull;
+    };
+
+    if (positionsHashStamp != positions.stamp()) {
+        hash = 14695981039346656037ull;
+        for (const vec2& p : positions) {
+            mix(p.x);
+            mix(p.y);
+        }
+        positionsHash = hash;
+        positionsHashStamp = positions.stamp();
+    }
+
+    hash = positionsHash;
+    for (const Vert& v : basis) {
+        mix(v.pos.x);
+        mix(v.pos.y);
+        mix(v.uv.x);
+        mix(v.uv.y);
+    }
+    mix(originUV.x);
+    mix(originUV.y);
+
+    // 0 is reserved for "never triangulated"
+    return hash == 0 ? 1 : hash;
+}
+
+/**
+ * @brief Triangulated vertex block for this region, only re-earcut when the region changed since the last call
+ * @param rebuilt set to whether the block had to be rebuilt
+ */
+const std::vector<float>& UVRegion::getMeshData(bool& rebuilt) const {
+    uint64_t version = contentVersion();
+    rebuilt = version != meshDataVersion || !meshData;
+    if (!rebuilt) return *meshData;
+
+    // Copies of this region may still hold the old block, so build a new one rather than editing it
+    auto data = std::make_shared<std::vector<float>>();
+    meshData = data;
+    meshDataVersion = version;
+    if (positions.size() < 3) return *data;
+
+    // Triangulate region, the earcut input only lives for this call
+    ScratchScope scratch;
+    std::pmr::vector<std::pmr::vector<std::array<double, 2>>> polygon(scratch.resource());
+    polygon.emplace_back();
+    polygon[0].reserve(positions.size());
+    
+    for (const vec2& v : positions) {
+        polygon[0].push_back({{static_cast<double>(v.x), static_cast<double>(v.y)}});
+    }
+
+    std::vector<uint32_t> indices = mapbox::earcut<uint32_t>(polygon);
+    data->reserve(indices.size() * 5);
+
+    // Generate triangles
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        for (int j = 0; j < 3; j++) {
+            uint32_t idx = indices[i + j];
+            const vec2& pos = positions[idx];
+            vec2 uv = sampleUV(pos);
+
+            data->push_back(pos.x);
+            data->push_back(-pos.y);
+            data->push_back(0.0f);
+            data->push_back(uv.x);
+            data->push_back(-uv.y);
+        }
+    }
+
+    return *data;
+}
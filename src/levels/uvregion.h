@@ -3,12 +3,23 @@
 
 #include "util/includes.h"
 #include "util/maths.h"
+#include "util/clipper_helper.h"
+#include <span>
 
 struct UVRegion {
-    std::vector<vec2> positions;     // Polygon vertices
+    CowPolygon positions;            // Polygon vertices, shared with copies until edited
     std::array<Vert, 2> basis;       // Two linearly independent direction vectors (pos delta, uv delta)
     vec2 originUV;                   // UV at positions[0] (the origin)
     bool isObstacle;
+    mutable FixedPolygon fixed;      // Fixed point copy of positions used by clipping
+
+    // Triangulated vertex block [x, y, z, u, v] from the last toData, valid while contentVersion() matches meshDataVersion
+    mutable std::shared_ptr<const std::vector<float>> meshData;
+    mutable uint64_t meshDataVersion = 0;
+
+    // Hash of positions alone, valid while positions.stamp() matches positionsHashStamp
+    mutable uint64_t positionsHash = 0;
+    mutable uint64_t positionsHashStamp = ~0ull;
 
     // Constructors
     UVRegion() = default;
@@ -22,11 +33,21 @@ struct UVRegion {
     UVRegion& operator=(UVRegion&& other) noexcept = default;
     ~UVRegion() = default; 
 
+    // Fixed point positions, setting them also writes the float positions
+    const Path64& getFixedPositions() const { return fixed.get(positions); }
+    void setFixedPositions(Path64 path) { fixed.set(std::move(path), positions); }
+
+    // Hash of everything the triangulation depends on (positions, basis, origin UV)
+    uint64_t contentVersion() const;
+    const std::vector<float>& getMeshData(bool& rebuilt) const;
+
     // Sample UV at any point using linear basis transformation
     vec2 sampleUV(const vec2& pos) const;
+    bool uvMap(mat2x2& m, vec2& c) const; // the same mapping as uv = m * pos + c, false if degenerate
     
     // Check if point is inside region (with epsilon tolerance)
     bool contains(const vec2& pos, float eps = 1e-6f) const;
+    void containsMany(std::span<const vec2> points, std::span<uint8_t> out, float eps = 1e-6f) const; // out[i] = contains(points[i])
     
     // Get distance from point to region
     float distance(const vec2& pos) const;
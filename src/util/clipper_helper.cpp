@@ -1,9 +1,16 @@
 #include "util/clipper_helper.h"
+#include "util/maths.h"
+#include "util/scratch.h"
 
 Paths64 makePaths64FromRegion(const std::vector<vec2>& region) {
     Paths64 paths;
     if (region.empty()) return paths;
 
+    paths.push_back(makePath64FromRegion(region));
+    return paths;
+}
+
+Path64 makePath64FromRegion(const std::vector<vec2>& region) {
     Path64 p;
     p.reserve(region.size());
     for (const vec2& v : region) {
@@ -11,14 +18,32 @@ Paths64 makePaths64FromRegion(const std::vector<vec2>& region) {
         long long y = llround(v.y * CLIPPER_SCALE);
         p.emplace_back(x, y);
     }
-    paths.push_back(std::move(p));
-    return paths;
+    return p;
 }
 
-std::vector<vec2> makeRegionFromPaths64(const Paths64& paths) {
-    // Choose the largest (by absolute area) path as the single region
-    if (paths.empty()) return {};
+void makeRegionFromPath64(const Path64& path, std::vector<vec2>& region) {
+    region.clear();
+    region.reserve(path.size());
+    for (const Point64& pt : path) {
+        region.emplace_back(
+            static_cast<float>(pt.x / CLIPPER_SCALE), 
+            static_cast<float>(pt.y / CLIPPER_SCALE)
+        );
+    }
+}
+
+void ensureCCW(Path64& path) {
+    if (Area(path) < 0.0) std::reverse(path.begin(), path.end());
+}
 
+void ensureCCW(CowPolygon& poly) {
+    if (signedArea(poly) < 0.0f) ensureCCW(poly.edit());
+}
+
+/**
+ * @brief Index of the path with the largest absolute area, paths must not be empty
+ */
+size_t largestPath(const Paths64& paths) {
     auto areaPath64 = [](const Path64& p) {
         // Signed area using int64; return absolute value (in integer coords)
         // area64 = sum(x_i*y_{i+1} - x_{i+1}*y_i) / 2
@@ -39,24 +64,21 @@ std::vector<vec2> makeRegionFromPaths64(const Paths64& paths) {
             bestIdx = i;
         }
     }
-    
-    const Path64& chosen = paths[bestIdx];
-    std::vector<vec2> out;
-    out.reserve(chosen.size());
-    for (const Point64& pt : chosen) {
-        out.emplace_back(
-            static_cast<float>(pt.x / CLIPPER_SCALE), 
-            static_cast<float>(pt.y / CLIPPER_SCALE)
-        );
-    }
-    
-    return simplifyCollinear(out);
+
+    return bestIdx;
 }
 
-std::vector<vec2> simplifyCollinear(const std::vector<vec2>& region, float epsilon) {
-    if (region.size() < 3) return region;
-    
+/**
+ * @brief Copy of region without its nearly collinear vertices, or all of it if fewer than 3 would be left
+ */
+template <typename Points>
+static std::vector<vec2> simplifiedCopy(const Points& region, float epsilon) {
     std::vector<vec2> simplified;
+    if (region.size() < 3) {
+        simplified.assign(region.begin(), region.end());
+        return simplified;
+    }
+    
     simplified.reserve(region.size());
     
     size_t n = region.size();
@@ -88,6 +110,81 @@ std::vector<vec2> simplifyCollinear(const std::vector<vec2>& region, float epsil
         }
     }
     
-    return (simplified.size() >= 3) ? simplified : region;
+    if (simplified.size() < 3) simplified.assign(region.begin(), region.end());
+    return simplified;
 }
 
+/**
+ * @brief Float view of a path in scratch memory
+ */
+static void scratchRegionFromPath64(const Path64& path, std::pmr::vector<vec2>& region) {
+    region.clear();
+    region.reserve(path.size());
+    for (const Point64& pt : path) {
+        region.emplace_back(
+            static_cast<float>(pt.x / CLIPPER_SCALE), 
+            static_cast<float>(pt.y / CLIPPER_SCALE)
+        );
+    }
+}
+
+std::vector<vec2> makeRegionFromPaths64(const Paths64& paths) {
+    // Choose the largest (by absolute area) path as the single region
+    if (paths.empty()) return {};
+    
+    ScratchScope scratch;
+    std::pmr::vector<vec2> out(scratch.resource());
+    scratchRegionFromPath64(paths[largestPath(paths)], out);
+    
+    return simplifiedCopy(out, EPSILON);
+}
+
+std::vector<vec2> simplifyCollinear(const std::vector<vec2>& region, float epsilon) {
+    return simplifiedCopy(region, epsilon);
+}
+
+
+/**
+ * @brief The fixed point path for the polygon, rebuilt from the floats only if they were edited since set()
+ */
+const Path64& FixedPolygon::get(const std::vector<vec2>& floats) {
+#if FIXED_POINT_GEOMETRY
+    bool matches = path && path->size() == floats.size();
+    for (size_t i = 0; matches && i < path->size(); ++i) {
+        matches = static_cast<float>((*path)[i].x / CLIPPER_SCALE) == floats[i].x
+               && static_cast<float>((*path)[i].y / CLIPPER_SCALE) == floats[i].y;
+    }
+    if (matches) return *path;
+#endif
+
+    path = std::make_shared<const Path64>(makePath64FromRegion(floats));
+    return *path;
+}
+
+/**
+ * @brief Stores a clipper result as the polygon and writes its float view
+ */
+void FixedPolygon::set(Path64&& fixed, CowPolygon& floats) {
+    ScratchScope scratch;
+    std::pmr::vector<vec2> view(scratch.resource());
+    scratchRegionFromPath64(fixed, view);
+    std::vector<vec2> simplified = simplifiedCopy(view, EPSILON);
+
+#if FIXED_POINT_GEOMETRY
+    // Drop the same nearly collinear vertices from the path so both stay index aligned
+    if (simplified.size() != view.size()) {
+        size_t kept = 0;
+        for (size_t i = 0; i < view.size() && kept < simplified.size(); ++i) {
+            if (view[i] == simplified[kept]) {
+                fixed[kept++] = fixed[i];
+            }
+        }
+        fixed.resize(kept);
+    }
+    path = std::make_shared<const Path64>(std::move(fixed));
+#else
+    path.reset();
+#endif
+
+    floats = std::move(simplified);
+}
@@ -3,6 +3,7 @@
 
 #include "util/includes.h"
 #include "clipper2/clipper.h"
+#include "util/cowPolygon.h"
 
 using namespace Clipper2Lib;
 
@@ -13,4 +14,22 @@ Paths64 makePaths64FromRegion(const std::vector<vec2>& region);
 std::vector<vec2> makeRegionFromPaths64(const Paths64& paths);
 std::vector<vec2> simplifyCollinear(const std::vector<vec2>& region, float epsilon=EPSILON);
 
+Path64 makePath64FromRegion(const std::vector<vec2>& region);
+void makeRegionFromPath64(const Path64& path, std::vector<vec2>& region);
+size_t largestPath(const Paths64& paths);
+void ensureCCW(Path64& path);
+void ensureCCW(CowPolygon& poly); // only detaches when the winding is actually flipped
+
+/**
+ * @brief Fixed point copy of a float polygon. With FIXED_POINT_GEOMETRY the int64 path is the master copy, 
+ * booleans start from it and the floats are only a view of it. The floats may still be edited directly 
+ * (reflection, flips), the path notices and is rebuilt from them on next use. Copies share the path.
+ */
+struct FixedPolygon {
+    std::shared_ptr<const Path64> path; // shared between copies like the floats
+
+    const Path64& get(const std::vector<vec2>& floats);
+    void set(Path64&& fixed, CowPolygon& floats);
+};
+
 #endif
@@ -3,4 +3,18 @@
 
 #define EPSILON 1e-6f
 
+// keep polygon geometry in clipper's int64 fixed point alongside the floats so repeated booleans do not drift
+#ifndef FIXED_POINT_GEOMETRY
+#define FIXED_POINT_GEOMETRY 1
+#endif
+
+// batched geometry kernels use SSE2 when the target has it, the scalar path otherwise
+#ifndef SIMD_GEOMETRY
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD_GEOMETRY 1
+#else
+#define SIMD_GEOMETRY 0
+#endif
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,76 @@
+#ifndef COW_POLYGON_H
+#define COW_POLYGON_H
+
+#include "util/includes.h"
+#include <memory>
+#include <atomic>
+
+/**
+ * @brief Polygon vertex list with copy-on-write storage. Copies share one immutable buffer, so snapshotting
+ * a mesh only copies pointers. Element access is read only, writes go through edit() (or the whole-list
+ * mutators below), which gives this polygon its own buffer first if it is shared. stamp() changes whenever the
+ * contents may have, so caches derived from the vertices can tell when they are stale.
+ */
+class CowPolygon {
+private:
+    std::shared_ptr<std::vector<vec2>> data; // null when empty
+    uint64_t editStamp = 0;                  // copies share it along with the buffer, 0 for a polygon never written
+
+    static uint64_t nextStamp() {
+        static std::atomic<uint64_t> counter{ 1 };
+        return counter++;
+    }
+
+    static const std::vector<vec2>& emptyPolygon() {
+        static const std::vector<vec2> empty;
+        return empty;
+    }
+
+public:
+    using value_type = vec2;
+    using const_iterator = std::vector<vec2>::const_iterator;
+
+    CowPolygon() = default;
+    CowPolygon(const std::vector<vec2>& verts) : data(std::make_shared<std::vector<vec2>>(verts)), editStamp(nextStamp()) {}
+    CowPolygon(std::vector<vec2>&& verts) : data(std::make_shared<std::vector<vec2>>(std::move(verts))), editStamp(nextStamp()) {}
+
+    CowPolygon(const CowPolygon& other) = default;
+    CowPolygon(CowPolygon&& other) noexcept = default;
+    CowPolygon& operator=(const CowPolygon& other) = default;
+    CowPolygon& operator=(CowPolygon&& other) noexcept = default;
+    ~CowPolygon() = default;
+
+    CowPolygon& operator=(const std::vector<vec2>& verts) { data = std::make_shared<std::vector<vec2>>(verts); editStamp = nextStamp(); return *this; }
+    CowPolygon& operator=(std::vector<vec2>&& verts) { data = std::make_shared<std::vector<vec2>>(std::move(verts)); editStamp = nextStamp(); return *this; }
+
+    // read access, never copies
+    const std::vector<vec2>& get() const { return data ? *data : emptyPolygon(); }
+    operator const std::vector<vec2>&() const { return get(); }
+
+    size_t size() const { return data ? data->size() : 0; }
+    bool empty() const { return size() == 0; }
+    const vec2& operator[](size_t i) const { return (*data)[i]; }
+    const_iterator begin() const { return get().begin(); }
+    const_iterator end() const { return get().end(); }
+    bool shares(const CowPolygon& other) const { return data == other.data; }
+    uint64_t stamp() const { return editStamp; }
+
+    // write access, detaches from any other polygon sharing the buffer. References into the
+    // old buffer (get(), iterators) must not be held across this call, and caches keyed on stamp() 
+    // must not be refreshed while the returned reference is still being written through
+    std::vector<vec2>& edit() {
+        editStamp = nextStamp();
+        if (!data) {
+            data = std::make_shared<std::vector<vec2>>();
+        } else if (data.use_count() > 1) {
+            data = std::make_shared<std::vector<vec2>>(*data);
+        }
+        return *data;
+    }
+
+    void clear() { data.reset(); editStamp = nextStamp(); }
+    void reserve(size_t n) { edit().reserve(n); }
+    void push_back(const vec2& v) { edit().push_back(v); }
+};
+
+#endif
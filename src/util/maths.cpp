@@ -111,6 +111,16 @@ void flipPolyY(std::vector<vec2>& poly) {
     for (vec2& v : poly) v.y *= -1;
 }
 
+std::pair<vec2, vec2> polygonBounds(const std::vector<vec2>& poly) {
+    vec2 bl = vec2{ std::numeric_limits<float>::infinity() };
+    vec2 tr = vec2{ -std::numeric_limits<float>::infinity() };
+    for (const vec2& v : poly) {
+        bl = glm::min(bl, v);
+        tr = glm::max(tr, v);
+    }
+    return { bl, tr };
+}
+
 std::pair<glm::vec3, glm::vec2> connectSquare(const glm::vec2& a, const glm::vec2& b, float width)
 {
     glm::vec2 delta = b - a;
@@ -137,6 +147,22 @@ bool lineSegmentsIntersect(const vec2& a0, const vec2& a1, const vec2& b0, const
     return (t >= 0.0f && t <= 1.0f && u >= 0.0f && u <= 1.0f);
 }
 
+bool lineSegmentsIntersect(const vec2& a0, const vec2& a1, const vec2& b0, const vec2& b1, float& t) {
+    vec2 d1 = a1 - a0;
+    vec2 d2 = b1 - b0;
+
+    float denom = cross(d1, d2);
+    if (std::abs(denom) < 1e-8f) return false; // Parallel
+
+    vec2 d = b0 - a0;
+    float ta = cross(d, d2) / denom;
+    float u = cross(d, d1) / denom;
+    if (ta < 0.0f || ta > 1.0f || u < 0.0f || u > 1.0f) return false;
+
+    t = ta;
+    return true;
+}
+
 bool lineSegmentIntersectsPolygon(const vec2& segStart, const vec2& segEnd, const std::vector<vec2>& polygon) {
     if (polygon.size() < 3) return false;
     
@@ -18,6 +18,7 @@ bool isCCW(const vec2& a, const vec2& b, const vec2& c);
 // folding helpers
 bool intersectLineSegmentInfiniteLine(const vec2& a0, const vec2& a1,const vec2& b0, const vec2& bDir,vec2& outIntersection);
 bool lineSegmentsIntersect(const vec2& a0, const vec2& a1, const vec2& b0, const vec2& b1);
+bool lineSegmentsIntersect(const vec2& a0, const vec2& a1, const vec2& b0, const vec2& b1, float& t); // t is the hit's fraction along a
 bool lineSegmentIntersectsPolygon(const vec2& segStart, const vec2& segEnd, const std::vector<vec2>& polygon);
 vec2 nearestPointOnEdgeToPoint(const vec2& start, const vec2& end, const vec2& point);
 float distancePointToEdge(const vec2& start, const vec2& end, const vec2& point);
@@ -26,6 +27,7 @@ vec2 reflectPointOverLine(const vec2& pos, const vec2& dir, const vec2& point);
 float signedArea(const std::vector<vec2>& poly);
 void ensureCCW(std::vector<vec2>& poly);
 void flipPolyY(std::vector<vec2>& poly);
+std::pair<vec2, vec2> polygonBounds(const std::vector<vec2>& poly);
 std::pair<glm::vec3, glm::vec2> connectSquare(const glm::vec2& a, const glm::vec2& b, float width=0.1f);
 
 #endif
@@ -0,0 +1,44 @@
+#include "util/scratch.h"
+
+std::atomic<uint64_t> ScratchArena::requests = 0;
+std::atomic<uint64_t> ScratchArena::heapAllocations = 0;
+std::atomic<uint64_t> ScratchArena::operations = 0;
+
+ScratchArena::ScratchArena() :
+    initial(INITIAL_BYTES),
+    heap(std::pmr::new_delete_resource(), heapAllocations),
+    monotonic(initial.data(), initial.size(), &heap),
+    front(&monotonic, requests)
+{}
+
+ScratchArena& ScratchArena::get() {
+    static thread_local ScratchArena arena;
+    return arena;
+}
+
+void ScratchArena::end() {
+    if (depth == 0 || --depth > 0) return;
+
+    // hands back every block past the initial one and rewinds to its start
+    monotonic.release();
+    operations.fetch_add(1, std::memory_order_relaxed);
+}
+
+ScratchArena::Stats ScratchArena::getStats() {
+    Stats stats;
+    stats.requests = requests.load(std::memory_order_relaxed);
+    stats.heapAllocations = heapAllocations.load(std::memory_order_relaxed);
+    stats.operations = operations.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void ScratchArena::resetStats() {
+    requests.store(0, std::memory_order_relaxed);
+    heapAllocations.store(0, std::memory_order_relaxed);
+    operations.store(0, std::memory_order_relaxed);
+}
+
+void* ScratchArena::CountingResource::do_allocate(size_t bytes, size_t alignment) {
+    count.fetch_add(1, std::memory_order_relaxed);
+    return target->allocate(bytes, alignment);
+}
@@ -0,0 +1,79 @@
+#ifndef SCRATCH_H
+#define SCRATCH_H
+
+#include "util/includes.h"
+#include <memory_resource>
+#include <atomic>
+
+/**
+ * @brief Per-thread bump allocator for geometry temporaries, used through std::pmr containers. Everything 
+ * taken inside a ScratchScope is released at once when the outermost scope on the thread closes. The first 
+ * block is kept, so the next operation usually does not touch the heap at all.
+ */
+class ScratchArena {
+public:
+    struct Stats {
+        uint64_t requests = 0;        // allocations served by arenas
+        uint64_t heapAllocations = 0; // blocks arenas had to take from the heap
+        uint64_t operations = 0;      // outermost scopes closed
+    };
+
+    static ScratchArena& get(); // this thread's arena
+    static Stats getStats();    // summed over all threads since the last reset
+    static void resetStats();
+
+    std::pmr::memory_resource* resource() { return &front; }
+    void begin() { depth++; }
+    void end();
+
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+
+private:
+    static constexpr size_t INITIAL_BYTES = 256 * 1024;
+
+    // forwards to another resource, counting allocations
+    class CountingResource : public std::pmr::memory_resource {
+    private:
+        std::pmr::memory_resource* target;
+        std::atomic<uint64_t>& count;
+
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override { target->deallocate(p, bytes, alignment); }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    public:
+        CountingResource(std::pmr::memory_resource* target, std::atomic<uint64_t>& count) : target(target), count(count) {}
+    };
+
+    static std::atomic<uint64_t> requests;
+    static std::atomic<uint64_t> heapAllocations;
+    static std::atomic<uint64_t> operations;
+
+    std::vector<std::byte> initial;
+    CountingResource heap;
+    std::pmr::monotonic_buffer_resource monotonic;
+    CountingResource front;
+    uint depth = 0;
+
+    ScratchArena();
+};
+
+/**
+ * @brief Marks one operation on this thread's arena, containers using it must not outlive the scope
+ */
+class ScratchScope {
+private:
+    ScratchArena& arena;
+
+public:
+    ScratchScope() : arena(ScratchArena::get()) { arena.begin(); }
+    ~ScratchScope() { arena.end(); }
+
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope& operator=(const ScratchScope&) = delete;
+
+    std::pmr::memory_resource* resource() { return arena.resource(); }
+};
+
+#endif
@@ -0,0 +1,26 @@
+#include "util/spatialHash.h"
+
+void SpatialHash::clear() {
+    entries.clear();
+    cells.clear();
+}
+
+void SpatialHash::insert(const vec2& pos, float radius, uint layer, uint id) {
+    uint index = entries.size();
+    entries.push_back({ pos, radius, layer, id });
+
+    glm::ivec2 lo = cellOf(pos - vec2(radius));
+    glm::ivec2 hi = cellOf(pos + vec2(radius));
+    for (int x = lo.x; x <= hi.x; x++) {
+        for (int y = lo.y; y <= hi.y; y++) {
+            cells.emplace_back(keyOf(x, y), index);
+        }
+    }
+}
+
+void SpatialHash::build() {
+    std::sort(cells.begin(), cells.end());
+    if (stamps.size() < entries.size()) stamps.resize(entries.size(), 0);
+    std::fill(stamps.begin(), stamps.begin() + entries.size(), 0);
+    queryStamp = 0;
+}
@@ -0,0 +1,71 @@
+#ifndef SPATIAL_HASH_H
+#define SPATIAL_HASH_H
+
+#include "util/includes.h"
+#include <glm/gtx/norm.hpp>
+
+/**
+ * @brief Uniform grid broadphase for circles, rebuilt from scratch every frame. Each circle is stored in every
+ * cell its bounding box touches along with a layer bitmask, so a query only visits nearby circles on layers it cares about.
+ * Buffers are kept between rebuilds so a steady frame does not allocate.
+ */
+class SpatialHash {
+private:
+    struct Entry {
+        vec2 pos;
+        float radius;
+        uint layer;
+        uint id;
+    };
+
+    float invCellSize;
+    std::vector<Entry> entries;
+    std::vector<std::pair<uint64_t, uint>> cells; // (cell key, entry index) sorted by key after build()
+    std::vector<uint> stamps; // last query that reported each entry, so multi cell entries report once
+    uint queryStamp = 0;
+
+    glm::ivec2 cellOf(const vec2& pos) const { return glm::ivec2(glm::floor(pos * invCellSize)); }
+    static uint64_t keyOf(int x, int y) { return ((uint64_t) (uint32_t) x << 32) | (uint32_t) y; }
+
+public:
+    SpatialHash(float cellSize = 1.0f) : invCellSize(1.0f / cellSize) {}
+
+    void clear();
+    void insert(const vec2& pos, float radius, uint layer, uint id);
+    void build();
+
+    /**
+     * @brief Calls func with the id of every circle on a layer in layerMask that overlaps the query circle.
+     * Each id is reported at most once. Entries must not be inserted while a query is running.
+     */
+    template <typename F>
+    void query(const vec2& pos, float radius, uint layerMask, F&& func) {
+        if (cells.empty()) return;
+
+        // stamps are reset on build, so this only wraps if a single frame runs 4 billion queries
+        queryStamp++;
+
+        glm::ivec2 lo = cellOf(pos - vec2(radius));
+        glm::ivec2 hi = cellOf(pos + vec2(radius));
+        for (int x = lo.x; x <= hi.x; x++) {
+            for (int y = lo.y; y <= hi.y; y++) {
+                uint64_t key = keyOf(x, y);
+                auto it = std::lower_bound(cells.begin(), cells.end(), std::make_pair(key, 0u));
+                for (; it != cells.end() && it->first == key; it++) {
+                    uint index = it->second;
+                    if (stamps[index] == queryStamp) continue;
+                    stamps[index] = queryStamp;
+
+                    const Entry& entry = entries[index];
+                    if ((entry.layer & layerMask) == 0) continue;
+                    float combined = entry.radius + radius;
+                    if (glm::length2(entry.pos - pos) <= combined * combined) func(entry.id);
+                }
+            }
+        }
+    }
+
+    size_t size() const { return entries.size(); }
+};
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include "util/includes.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+/**
+ * @brief Fixed set of worker threads running jobs from a shared FIFO queue. 
+ * Jobs still queued when the pool is destroyed are dropped, running jobs are joined.
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> jobs;
+    std::mutex mutex;
+    std::condition_variable available;
+    std::condition_variable idle;
+    uint pending = 0; // queued or running jobs
+    bool stopping = false;
+
+    void work();
+
+public:
+    ThreadPool(uint numThreads = 0); // 0 uses one less than the hardware concurrency
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    void submit(std::function<void()> job);
+    void wait(); // blocks until every submitted job has finished
+    uint size() const { return workers.size(); }
+};
+
+#endif
@@ -9,6 +9,9 @@ public:
     ~ContactZone() = default;
 
     bool update(float dt) override;
+
+    void reset(Character* owner, Node2D::Params node, Params params, const vec2& pos) { DamageZone::reset(owner, node, params, pos, vec2()); }
+    void recycle(ZonePool& pool) override { pool.park(this); }
 };
 
 #endif
\ No newline at end of file
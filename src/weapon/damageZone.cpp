@@ -3,19 +3,49 @@
 
 DamageZone::DamageZone(Character* owner, Node2D::Params node, Params params, const vec2& pos, const vec2& dir) : 
     Node2D(owner->getSide()->getScene(), node),
-    owner(owner),
-    damage(params.damage),
-    life(params.life),
-    vel(params.speed * dir),
-    radius(params.radius),
-    friendlyDamage(params.friendlyDamage),
-    selfDamage(params.selfDamage),
-    onExpire(params.onExpire),
-    onHit(params.onHit)
+    poolable(ZonePool::canPool(node))
 {
+    init(owner, params, pos, dir);
+}
+
+void DamageZone::init(Character* owner, Params params, const vec2& pos, const vec2& dir) {
+    this->owner = owner;
+    damage = params.damage;
+    life = params.life;
+    vel = params.speed * dir;
+    radius = params.radius;
+    friendlyDamage = params.friendlyDamage;
+    selfDamage = params.selfDamage;
+    onExpire = params.onExpire;
+    onHit = params.onHit;
+
     this->setPosition(pos);
 }
 
+/**
+ * @brief Brings a parked zone back into play as if it was just constructed. The zone stays in the scene it was created in.
+ * Only called with node params that pass ZonePool::canPool, so there is no collider to restore, and the position comes from pos as in the constructor
+ */
+void DamageZone::reset(Character* owner, Node2D::Params node, Params params, const vec2& pos, const vec2& dir) {
+    setMesh(node.mesh);
+    setMaterial(node.material);
+    setRotation(node.rotation);
+    setScale(node.scale);
+    init(owner, params, pos, dir);
+}
+
+/**
+ * @brief Hides the zone and drops its callbacks so it can sit in a ZonePool, invalidating any handles to it
+ */
+void DamageZone::park() {
+    generation++;
+    owner = nullptr;
+    onExpire = nullptr;
+    onHit = nullptr;
+    vel = vec2(0.0f);
+    setScale(vec2(0.0f));
+}
+
 bool DamageZone::update(float dt) {
     this->setPosition(this->getPosition() + dt * vel);
 
@@ -32,7 +62,7 @@ bool DamageZone::hit(Character* other) {
     if (!other) return false;
 
     bool isSelf = (owner == other);
-    bool isFriendly = (owner->getTeam() == other->getTeam());
+    bool isFriendly = (owner->getTeamLayer() == other->getTeamLayer());
 
     // skip damage
     if ((isSelf && !selfDamage) || (isFriendly && !friendlyDamage)) {
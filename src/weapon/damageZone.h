@@ -3,6 +3,7 @@
 
 #include "util/includes.h"
 #include "character/character.h"
+#include "weapon/zonePool.h"
 
 class DamageZone : public Node2D {
 public:
@@ -31,12 +32,26 @@ protected:
     std::function<void()> onExpire;
     std::function<void(Character*)> onHit;
 
+    // pooling
+    bool poolable;
+    uint generation = 0;
+
+    void init(Character* owner, Params params, const vec2& pos, const vec2& dir);
+
 public:
     DamageZone(Character* owner, Node2D::Params node, Params params, const vec2& pos, const vec2& dir);
     virtual ~DamageZone() = default;
 
     bool virtual hit(Character* other);
     bool virtual update(float dt);
+
+    // pooling, see ZonePool
+    void reset(Character* owner, Node2D::Params node, Params params, const vec2& pos, const vec2& dir);
+    void park();
+    virtual void recycle(ZonePool& pool) { pool.park(this); }
+    bool isPoolable() const { return poolable; }
+    uint getGeneration() const { return generation; }
+    ZoneHandle getHandle() { return { this, generation }; }
     
     Character* getOwner() const { return owner; }
 
@@ -45,6 +60,7 @@ public:
     float getRadius() { return radius; }
     int getDamage() const { return damage; }
     bool getFriendlyDamage() const { return friendlyDamage; }
+    uint getHitMask() const { return friendlyDamage ? ~0u : ~owner->getTeamLayer(); } // layers hit() can damage
 
     // setters
     void setOnHit(std::function<void(Character*)> func) { onHit = func; }
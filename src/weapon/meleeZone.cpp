@@ -5,6 +5,11 @@ MeleeZone::MeleeZone(Character* owner, Node2D::Params node, Params params, const
     knockback(knockback)
 {}
 
+void MeleeZone::reset(Character* owner, Node2D::Params node, Params params, const vec2& pos, const vec2& dir, float knockback) {
+    DamageZone::reset(owner, node, params, pos, dir);
+    this->knockback = knockback;
+}
+
 bool MeleeZone::update(float dt) {
     if (DamageZone::update(dt) == false) return false;
 
@@ -13,6 +13,9 @@ public:
 
     bool update(float dt) override;
     bool hit(Character* other) override;
+
+    void reset(Character* owner, Node2D::Params node, Params params, const vec2& pos, const vec2& dir, float knockback=0);
+    void recycle(ZonePool& pool) override { pool.park(this); }
 };
 
 #endif
\ No newline at end of file
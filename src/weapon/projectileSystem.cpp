@@ -0,0 +1,109 @@
+#include "weapon/projectileSystem.h"
+#include "weapon/projectileZone.h"
+#include "levels/levels.h"
+
+void ProjectileSystem::add(ProjectileZone* zone, const vec2& pos, const vec2& vel, float life, int ricochet) {
+    posX.push_back(pos.x);
+    posY.push_back(pos.y);
+    velX.push_back(vel.x);
+    velY.push_back(vel.y);
+    this->life.push_back(life);
+    this->ricochet.push_back(ricochet);
+    zones.push_back(zone->getHandle());
+}
+
+void ProjectileSystem::removeAt(uint index) {
+    uint last = zones.size() - 1;
+    posX[index] = posX[last]; posX.pop_back();
+    posY[index] = posY[last]; posY.pop_back();
+    velX[index] = velX[last]; velX.pop_back();
+    velY[index] = velY[last]; velY.pop_back();
+    life[index] = life[last]; life.pop_back();
+    ricochet[index] = ricochet[last]; ricochet.pop_back();
+    zones[index] = zones[last]; zones.pop_back();
+}
+
+/**
+ * @brief Drops zones retired since the last update, and ones that hit a character, which the side retires without expiring them
+ */
+void ProjectileSystem::dropRetired() {
+    for (uint i = 0; i < zones.size();) {
+        ProjectileZone* zone = static_cast<ProjectileZone*>(zones[i].get());
+        if (zone == nullptr || zone->expired || zone->hasHit) removeAt(i);
+        else i++;
+    }
+}
+
+/**
+ * @brief Advances every projectile by dt. Projectiles whose life ran out call onExpire, ones that hit an obstacle
+ * bounce if they have ricochets left and are otherwise marked expired, as are ones that end the move inside an obstacle. Expired zones are retired by SingleSide::update
+ * @param paperMesh mesh of this side, no obstacle sweep when null
+ */
+void ProjectileSystem::update(float dt, const PaperMesh* paperMesh) {
+    dropRetired();
+
+    // integrate
+    size_t n = zones.size();
+    startX.assign(posX.begin(), posX.end());
+    startY.assign(posY.begin(), posY.end());
+    for (size_t i = 0; i < n; i++) {
+        posX[i] += velX[i] * dt;
+        posY[i] += velY[i] * dt;
+        life[i] -= dt;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        ProjectileZone* zone = static_cast<ProjectileZone*>(zones[i].zone);
+
+        if (life[i] <= 0.0f) {
+            if (zone->onExpire) zone->onExpire();
+            zone->expired = true;
+            continue;
+        }
+
+        // sweep the move against the obstacle edges
+        vec2 start = { startX[i], startY[i] };
+        vec2 end = { posX[i], posY[i] };
+        float t;
+        vec2 normal;
+        if (paperMesh != nullptr && paperMesh->sweepObstacles(start, end, t, normal)) {
+            if (ricochet[i] <= 0) {
+                zone->expired = true;
+                continue;
+            }
+
+            // reflect off the edge, resting just in front of it for the rest of this frame
+            vec2 vel = { velX[i], velY[i] };
+            vel -= 2.0f * glm::dot(vel, normal) * normal;
+            end = start + (end - start) * t + normal * 1e-3f;
+
+            velX[i] = vel.x;
+            velY[i] = vel.y;
+            posX[i] = end.x;
+            posY[i] = end.y;
+            ricochet[i]--;
+
+            zone->vel = vel;
+            zone->face(vel);
+        }
+
+        // the sweep only sees edges crossed this frame, so a projectile that spawned inside an obstacle
+        // or had one folded on top of it is caught here
+        if (paperMesh != nullptr && paperMesh->obstacleContains(end)) {
+            zone->expired = true;
+            continue;
+        }
+
+        zone->setPosition(end);
+    }
+}
+
+void ProjectileSystem::clear() {
+    posX.clear();
+    posY.clear();
+    velX.clear();
+    velY.clear();
+    life.clear();
+    ricochet.clear();
+    zones.clear();
+}
@@ -0,0 +1,38 @@
+#ifndef PROJECTILE_SYSTEM_H
+#define PROJECTILE_SYSTEM_H
+
+#include "util/includes.h"
+#include "weapon/zonePool.h"
+
+class ProjectileZone;
+struct PaperMesh;
+
+/**
+ * @brief Moves every pooled projectile on a side in one pass. Motion state lives here in parallel arrays, so the
+ * integration is a single loop the compiler can vectorize. Each move is then swept against the paper's obstacle edge grid,
+ * so fast projectiles cannot tunnel through thin walls and can ricochet off them. The sweep is of the center point, 
+ * like the old per zone obstacle test, the zone radius only applies to hits on characters.
+ * The zones keep their nodes for drawing and hit tests, positions are written back after every update.
+ */
+class ProjectileSystem {
+private:
+    std::vector<float> posX, posY;
+    std::vector<float> velX, velY;
+    std::vector<float> life;
+    std::vector<int> ricochet;
+    std::vector<ZoneHandle> zones; // stale once the zone is retired
+
+    std::vector<float> startX, startY; // positions before this update's move
+
+    void removeAt(uint index);
+
+public:
+    void add(ProjectileZone* zone, const vec2& pos, const vec2& vel, float life, int ricochet);
+    void dropRetired();
+    void update(float dt, const PaperMesh* paperMesh);
+    void clear();
+
+    size_t size() const { return zones.size(); }
+};
+
+#endif
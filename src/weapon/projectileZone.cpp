@@ -7,6 +7,29 @@ ProjectileZone::ProjectileZone(Character* owner, Node2D::Params node, Params par
     DamageZone(owner, node, params, pos, dir),
     ricochet(ricochet)
 {
+    aim(dir, params.speed);
+    launch();
+}
+
+void ProjectileZone::reset(Character* owner, Node2D::Params node, Params params, const vec2& pos, const vec2& dir, int ricochet) {
+    DamageZone::reset(owner, node, params, pos, dir);
+    this->ricochet = ricochet;
+    hasHit = false;
+    aim(dir, params.speed);
+    launch();
+}
+
+/**
+ * @brief Hands the projectile's motion to its side's ProjectileSystem. Zones that cannot be pooled keep moving themselves,
+ * since the system only notices retired zones through their generation
+ */
+void ProjectileZone::launch() {
+    expired = false;
+    batched = poolable;
+    if (batched) owner->getSide()->getProjectiles().add(this, getPosition(), vel, life, ricochet);
+}
+
+void ProjectileZone::aim(const vec2& dir, float speed) {
     // Add random spread to the direction (spread angle in radians)
     const float spreadAngle = uniform(-0.15f, 0.15f);  // ~±8.6 degrees of spread
     float cosAngle = std::cos(spreadAngle);
@@ -18,10 +41,13 @@ ProjectileZone::ProjectileZone(Character* owner, Node2D::Params node, Params par
         dir.x * sinAngle + dir.y * cosAngle
     };
     
-    this->vel = spreadDir * params.speed;
-    
+    this->vel = spreadDir * speed;
+    face(spreadDir);
+}
+
+void ProjectileZone::face(const vec2& dir) {
     // Calculate rotation angle so that (-1, 0) is 0 degrees
-    // Use the spread direction for rotation so the sprite faces the actual travel direction
+    // Use the travel direction so the sprite faces where it is actually going
     // Standard atan2(y, x): (1,0)=0°, (0,1)=90°, (-1,0)=180°, (0,-1)=270°
     // We want: (-1,0)=0°, (0,1)=90°, (1,0)=180°, (0,-1)=270°
     // Solution: use atan2(dir.y, -dir.x) which correctly maps:
@@ -29,7 +55,7 @@ ProjectileZone::ProjectileZone(Character* owner, Node2D::Params node, Params par
     //   (0,1) → atan2(1, 0) = 90° ✓
     //   (1,0) → atan2(0, -1) = 180° ✓
     //   (0,-1) → atan2(-1, 0) = 270° ✓
-    float angle = std::atan2(spreadDir.y, spreadDir.x);
+    float angle = std::atan2(dir.y, dir.x);
     if (angle < 0) angle += 2.0f * 3.14159265358979323846f;
     angle += 3.14159265358979323846f;
     
@@ -54,6 +80,11 @@ bool ProjectileZone::update(float dt) {
     if (hasHit) {
         return false;
     }
+
+    // motion and obstacle hits were already handled in the side's batch
+    if (batched) {
+        return !expired;
+    }
     
     if (DamageZone::update(dt) == false) return false;
 
@@ -61,13 +92,9 @@ bool ProjectileZone::update(float dt) {
     if (owner != nullptr) {
         PaperMesh* paperMesh = owner->getPaperMeshForSide();
         if (paperMesh != nullptr) {
-            vec2 projPos = getPosition();
-            // Check all UVRegions for obstacle collisions
-            for (const auto& uvRegion : paperMesh->regions) {
-                if (uvRegion.isObstacle && uvRegion.contains(projPos)) {
-                    // Destroy projectile if it's inside an obstacle
-                    return false;
-                }
+            // Destroy projectile if it's inside an obstacle
+            if (paperMesh->obstacleContains(getPosition())) {
+                return false;
             }
         }
     }
@@ -4,9 +4,17 @@
 #include "weapon/damageZone.h"
 
 class ProjectileZone : public DamageZone {
+    friend class ProjectileSystem;
+
 private:
     int ricochet = 0;
     bool hasHit = false;
+    bool batched = false; // moved by the side's ProjectileSystem instead of update
+    bool expired = false; // set by the ProjectileSystem on running out of life or hitting an obstacle
+
+    void aim(const vec2& dir, float speed);
+    void face(const vec2& dir);
+    void launch();
 
 public:
     ProjectileZone(Character* owner, Node2D::Params node, Params params, const vec2& pos, const vec2& dir, int ricochet=0);
@@ -14,6 +22,9 @@ public:
 
     bool hit(Character* other) override;
     bool update(float dt) override;
+
+    void reset(Character* owner, Node2D::Params node, Params params, const vec2& pos, const vec2& dir, int ricochet=0);
+    void recycle(ZonePool& pool) override { pool.park(this); }
 };
 
 #endif
\ No newline at end of file
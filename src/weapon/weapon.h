@@ -12,7 +12,7 @@ class Character;
 class Weapon {
 protected:
     Character* owner;
-    std::function<DamageZone*(const vec2&, const vec2&)> damageZoneGen;
+    std::function<DamageZone*(ZonePool&, const vec2&, const vec2&)> damageZoneGen;
     float cooldown = 0;
     float maxCooldown;
     float range;
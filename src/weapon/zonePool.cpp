@@ -0,0 +1,50 @@
+#include "weapon/zonePool.h"
+#include "weapon/damageZone.h"
+
+DamageZone* ZoneHandle::get() const {
+    if (zone == nullptr || zone->getGeneration() != generation) return nullptr;
+    return zone;
+}
+
+/**
+ * @brief Takes a zone out of play. Zones that cannot be parked (ones with a collider, which would stay in the solver) are deleted instead
+ */
+void ZonePool::release(DamageZone* zone) {
+    if (zone == nullptr) return;
+    if (!zone->isPoolable()) {
+        delete zone;
+        return;
+    }
+
+    zone->park();
+    zone->recycle(*this);
+}
+
+/**
+ * @brief Deletes the oldest parked zones of each type past MAX_PARKED, so a burst does not leave its peak in the scene for good
+ */
+void ZonePool::trim() {
+    auto trimList = [](auto& list) {
+        if (list.size() <= MAX_PARKED) return;
+        for (size_t i = 0; i < list.size() - MAX_PARKED; i++) {
+            delete list[i];
+        }
+        list.erase(list.begin(), list.end() - MAX_PARKED);
+    };
+    trimList(contacts);
+    trimList(melees);
+    trimList(projectiles);
+}
+
+/**
+ * @brief Forgets all parked zones without deleting them, used when the scene that owns them is deleted
+ */
+void ZonePool::clear() {
+    contacts.clear();
+    melees.clear();
+    projectiles.clear();
+}
+
+void ZonePool::park(DamageZone* zone) {
+    delete zone; // plain zones are not pooled
+}
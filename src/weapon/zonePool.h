@@ -0,0 +1,82 @@
+#ifndef ZONE_POOL_H
+#define ZONE_POOL_H
+
+#include "util/includes.h"
+#include <type_traits>
+
+class Character;
+class DamageZone;
+class ContactZone;
+class MeleeZone;
+class ProjectileZone;
+
+/**
+ * @brief Handle to a pooled damage zone, held by the side's ProjectileSystem. Pooled zones never move, and are only freed 
+ * by ZonePool::trim once the side has dropped its stale handles, so the pointer stays valid and the generation tells 
+ * whether the zone has been recycled since the handle was taken.
+ */
+struct ZoneHandle {
+    DamageZone* zone = nullptr;
+    uint generation = 0;
+
+    DamageZone* get() const;
+};
+
+/**
+ * @brief Per side free lists of parked damage zones, one per concrete type. A zone that has expired is parked
+ * (hidden, node kept in the scene) and handed out again by the next acquire of the same type, so steady fire does not allocate.
+ * Parked nodes stay in the scene at scale 0, so the scene still walks them. That is the trade-off for never allocating
+ * a node mid fight, trim() bounds it by deleting zones parked past MAX_PARKED of a type. Parked zones are owned by the side's scene and are freed with it.
+ */
+class ZonePool {
+public:
+    static constexpr size_t MAX_PARKED = 64;
+
+private:
+    std::vector<ContactZone*> contacts;
+    std::vector<MeleeZone*> melees;
+    std::vector<ProjectileZone*> projectiles;
+
+    template <typename T>
+    std::vector<T*>& freeList() {
+        if constexpr (std::is_same_v<T, ContactZone>) return contacts;
+        else if constexpr (std::is_same_v<T, MeleeZone>) return melees;
+        else return projectiles;
+    }
+
+public:
+    /**
+     * @brief Whether a zone built from these node params can be parked and reset. Parked zones only carry
+     * mesh, material and transform, a collider (with its scale and density) would stay in the solver
+     */
+    static bool canPool(const Node2D::Params& node) { return node.collider == nullptr; }
+
+    /**
+     * @brief Reuses a parked zone of type T if there is one and the node params can be pooled, otherwise allocates a new one.
+     * Arguments match T's constructor.
+     */
+    template <typename T, typename... Args>
+    T* acquire(Character* owner, const Node2D::Params& node, Args&&... args) {
+        std::vector<T*>& list = freeList<T>();
+        if (list.empty() || !canPool(node)) return new T(owner, node, std::forward<Args>(args)...);
+
+        T* zone = list.back();
+        list.pop_back();
+        zone->reset(owner, node, std::forward<Args>(args)...);
+        return zone;
+    }
+
+    void release(DamageZone* zone);
+    void trim(); // nothing may hold a parked zone, not even a stale handle
+    void clear();
+
+    // called back by DamageZone::recycle with the concrete type
+    void park(DamageZone* zone);
+    void park(ContactZone* zone) { contacts.push_back(zone); }
+    void park(MeleeZone* zone) { melees.push_back(zone); }
+    void park(ProjectileZone* zone) { projectiles.push_back(zone); }
+
+    size_t parkedCount() const { return contacts.size() + melees.size() + projectiles.size(); }
+};
+
+#endif